@@ -0,0 +1,38 @@
+"""I2C Bus Arbiter Component for ESPHome
+
+Schedules bulk I2C writes (display frames, panel LED pushes) in chunks
+between latency-critical keypad reads. Components opt in with
+`i2c_arbiter_id`.
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+i2c_arbiter_ns = cg.esphome_ns.namespace("i2c_arbiter")
+I2CArbiter = i2c_arbiter_ns.class_("I2CArbiter", cg.PollingComponent)
+
+CONF_I2C_ARBITER_ID = "i2c_arbiter_id"
+CONF_BULK_BUDGET = "bulk_budget"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(I2CArbiter),
+        # Bus time per loop for bulk chunks (0 = send everything queued)
+        cv.Optional(CONF_BULK_BUDGET, default="2ms"): cv.positive_time_period_microseconds,
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_budget(config[CONF_BULK_BUDGET]))
+    cg.add_define("USE_I2C_ARBITER")
+
+
+async def register_arbiter_client(var, config):
+    """Hand the arbiter to a component that configured `i2c_arbiter_id`."""
+    if CONF_I2C_ARBITER_ID in config:
+        arbiter = await cg.get_variable(config[CONF_I2C_ARBITER_ID])
+        cg.add(var.set_i2c_arbiter(arbiter))
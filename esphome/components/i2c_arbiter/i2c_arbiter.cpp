@@ -0,0 +1,129 @@
+/**
+ * I2C Bus Arbiter Implementation
+ */
+#include "i2c_arbiter.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace i2c_arbiter {
+
+static const char *const TAG = "i2c_arbiter";
+
+void I2CArbiter::setup() { this->window_start_us_ = micros(); }
+
+void I2CArbiter::submit_bulk(BulkStep step) {
+  BulkJob job;
+  job.step = std::move(step);
+  job.submitted_us = micros();
+  this->queue_.push_back(std::move(job));
+
+  for (I2CArbiterStats *stats : {&this->total_, &this->window_}) {
+    stats->jobs_submitted++;
+    if (this->queue_.size() > stats->queue_depth_max) {
+      stats->queue_depth_max = this->queue_.size();
+    }
+  }
+}
+
+void I2CArbiter::run_urgent_() {
+  for (auto &poll : this->urgent_pollers_) {
+    poll();
+  }
+  this->total_.cut_ins++;
+  this->window_.cut_ins++;
+}
+
+void I2CArbiter::loop() {
+  if (this->queue_.empty() || this->running_) {
+    return;
+  }
+  this->running_ = true;
+
+  uint32_t start = micros();
+  while (!this->queue_.empty()) {
+    // Pending key events go out before the next chunk
+    this->run_urgent_();
+
+    BulkJob job = std::move(this->queue_.front());
+    this->queue_.pop_front();
+    if (!job.started) {
+      job.started = true;
+      uint32_t wait = micros() - job.submitted_us;
+      for (I2CArbiterStats *stats : {&this->total_, &this->window_}) {
+        stats->jobs_started++;
+        stats->wait_total_us += wait;
+        if (wait > stats->wait_max_us) {
+          stats->wait_max_us = wait;
+        }
+      }
+    }
+
+    bool done = job.step();
+    this->total_.chunks++;
+    this->window_.chunks++;
+    if (done) {
+      this->total_.jobs_completed++;
+      this->window_.jobs_completed++;
+    } else {
+      // Round-robin: a short panel LED push doesn't wait behind a whole frame
+      this->queue_.push_back(std::move(job));
+    }
+
+    if (this->budget_us_ > 0 && micros() - start >= this->budget_us_) {
+      break;
+    }
+  }
+
+  this->running_ = false;
+}
+
+void I2CArbiter::update() {
+  uint32_t now = micros();
+  uint32_t window_us = now - this->window_start_us_;
+  this->window_start_us_ = now;
+  if (window_us == 0) {
+    return;
+  }
+
+  const I2CArbiterStats &window = this->window_;
+  ESP_LOGD(TAG, "%u jobs (%u chunks), queue max %u, wait avg %u us / max %u us, %u cut-ins",
+           (unsigned) window.jobs_submitted, (unsigned) window.chunks, (unsigned) window.queue_depth_max,
+           (unsigned) window.wait_avg_us(), (unsigned) window.wait_max_us, (unsigned) window.cut_ins);
+
+  float values[METRIC_COUNT] = {
+      (float) window.queue_depth_max,
+      (float) window.wait_avg_us(),
+      (float) window.wait_max_us,
+      window.cut_ins / (window_us / 1e6f),
+  };
+  for (uint8_t i = 0; i < METRIC_COUNT; i++) {
+    if (this->sensors_[i] != nullptr) {
+      this->sensors_[i]->publish_state(values[i]);
+    }
+  }
+
+  // The window starts with whatever is still queued
+  this->window_ = I2CArbiterStats();
+  this->window_.queue_depth_max = this->queue_.size();
+}
+
+void I2CArbiter::dump_config() {
+  ESP_LOGCONFIG(TAG, "I2C Arbiter:");
+  LOG_UPDATE_INTERVAL(this);
+  if (this->budget_us_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Bulk Budget: %uus per loop", (unsigned) this->budget_us_);
+  } else {
+    ESP_LOGCONFIG(TAG, "  Bulk Budget: none (queue drained each loop)");
+  }
+  ESP_LOGCONFIG(TAG, "  Urgent Pollers: %u", (unsigned) this->urgent_pollers_.size());
+  const I2CArbiterStats &total = this->total_;
+  ESP_LOGCONFIG(TAG, "  Jobs: %u submitted, %u completed in %u chunks, queue max %u",
+                (unsigned) total.jobs_submitted, (unsigned) total.jobs_completed, (unsigned) total.chunks,
+                (unsigned) total.queue_depth_max);
+  ESP_LOGCONFIG(TAG, "  Wait: avg %u us, max %u us; %u urgent polls cut in", (unsigned) total.wait_avg_us(),
+                (unsigned) total.wait_max_us, (unsigned) total.cut_ins);
+}
+
+}  // namespace i2c_arbiter
+}  // namespace esphome
@@ -0,0 +1,102 @@
+/**
+ * I2C Bus Arbiter Component for ESPHome
+ *
+ * Schedules the shared I2C bus between latency-critical reads and bulk
+ * writes. Components keep issuing their own transactions; what the arbiter
+ * decides is when bulk work runs:
+ *
+ * - Bulk transfers (display frames, panel LED pushes) are submitted as jobs
+ *   that send one chunk per step. The arbiter steps queued jobs round-robin
+ *   from its loop(), up to a time budget per loop.
+ * - Urgent pollers (keypad event reads) run before every bulk chunk, so a
+ *   key event waits for at most one chunk, never for a whole frame.
+ *
+ * Queue depth, job wait time (submission to first chunk) and the number of
+ * urgent polls that cut in between chunks are kept per update window and
+ * since boot.
+ */
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace i2c_arbiter {
+
+// Default bus time per loop() spent on bulk chunks (0 = drain the queue)
+constexpr uint32_t I2C_ARBITER_BUDGET_US = 2000;
+
+// Sends one chunk of a bulk transfer; returns true once the transfer is complete
+using BulkStep = std::function<bool()>;
+// Services a latency-critical device (e.g. drains the keypad FIFO)
+using UrgentPoll = std::function<void()>;
+
+enum ArbiterMetric : uint8_t {
+  METRIC_QUEUE_DEPTH = 0,  // Deepest bulk queue in the window
+  METRIC_WAIT,             // Average job wait, submission to first chunk (us)
+  METRIC_WAIT_MAX,         // Longest job wait (us)
+  METRIC_CUT_INS,          // Urgent polls run between bulk chunks (per second)
+  METRIC_COUNT,
+};
+
+struct I2CArbiterStats {
+  uint32_t jobs_submitted{0};
+  uint32_t jobs_completed{0};
+  uint32_t chunks{0};          // Bulk steps run
+  uint32_t cut_ins{0};         // Urgent polls run ahead of a bulk chunk
+  uint32_t queue_depth_max{0};
+  uint64_t wait_total_us{0};
+  uint32_t wait_max_us{0};
+  uint32_t jobs_started{0};
+
+  uint32_t wait_avg_us() const {
+    return this->jobs_started > 0 ? (uint32_t) (this->wait_total_us / this->jobs_started) : 0;
+  }
+};
+
+class I2CArbiter : public PollingComponent {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  // Configuration (called from Python codegen)
+  void set_budget(uint32_t budget_us) { this->budget_us_ = budget_us; }
+  void set_sensor(ArbiterMetric metric, sensor::Sensor *sensor) { this->sensors_[metric] = sensor; }
+
+  // Latency-critical devices register a poll; it runs before every bulk chunk
+  void add_urgent_poller(UrgentPoll poll) { this->urgent_pollers_.push_back(std::move(poll)); }
+  // Queue a bulk transfer. The submitter must not change what the job sends
+  // until its last step has returned true.
+  void submit_bulk(BulkStep step);
+
+  size_t get_queue_depth() const { return this->queue_.size(); }
+  const I2CArbiterStats &get_stats() const { return this->total_; }
+
+ protected:
+  struct BulkJob {
+    BulkStep step;
+    uint32_t submitted_us{0};
+    bool started{false};
+  };
+
+  void run_urgent_();
+
+  uint32_t budget_us_{I2C_ARBITER_BUDGET_US};
+  std::vector<UrgentPoll> urgent_pollers_;
+  std::deque<BulkJob> queue_;
+  bool running_{false};  // Inside loop(): a poll that submits work doesn't recurse
+
+  I2CArbiterStats total_;   // Since boot
+  I2CArbiterStats window_;  // Since the last update()
+  uint32_t window_start_us_{0};
+  sensor::Sensor *sensors_[METRIC_COUNT]{};
+};
+
+}  // namespace i2c_arbiter
+}  // namespace esphome
@@ -0,0 +1,57 @@
+"""Sensor Platform for the I2C Bus Arbiter."""
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MICROSECOND,
+)
+from . import i2c_arbiter_ns, I2CArbiter, CONF_I2C_ARBITER_ID
+
+DEPENDENCIES = ["i2c_arbiter"]
+
+CONF_QUEUE_DEPTH = "queue_depth"
+CONF_WAIT = "wait"
+CONF_WAIT_MAX = "wait_max"
+CONF_CUT_INS = "cut_ins"
+
+ArbiterMetric = i2c_arbiter_ns.enum("ArbiterMetric")
+
+METRICS = {
+    CONF_QUEUE_DEPTH: ArbiterMetric.METRIC_QUEUE_DEPTH,
+    CONF_WAIT: ArbiterMetric.METRIC_WAIT,
+    CONF_WAIT_MAX: ArbiterMetric.METRIC_WAIT_MAX,
+    CONF_CUT_INS: ArbiterMetric.METRIC_CUT_INS,
+}
+
+
+def _diagnostic(unit, icon, accuracy=0):
+    kwargs = {"unit_of_measurement": unit} if unit else {}
+    return sensor.sensor_schema(
+        icon=icon,
+        accuracy_decimals=accuracy,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        **kwargs,
+    )
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_I2C_ARBITER_ID): cv.use_id(I2CArbiter),
+        cv.Optional(CONF_QUEUE_DEPTH): _diagnostic(None, "mdi:tray-full"),
+        cv.Optional(CONF_WAIT): _diagnostic(UNIT_MICROSECOND, "mdi:timer-sand"),
+        cv.Optional(CONF_WAIT_MAX): _diagnostic(UNIT_MICROSECOND, "mdi:timer-alert-outline"),
+        cv.Optional(CONF_CUT_INS): _diagnostic("1/s", "mdi:debug-step-into", 1),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_I2C_ARBITER_ID])
+    for key, metric in METRICS.items():
+        if key not in config:
+            continue
+        sens = await sensor.new_sensor(config[key])
+        cg.add(parent.set_sensor(metric, sens))
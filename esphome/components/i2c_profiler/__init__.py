@@ -0,0 +1,34 @@
+"""I2C Bus Profiler Component for ESPHome
+
+Wraps an I2C bus and records per-device transactions, bytes, NACKs and
+latency. Point components at the profiler's id instead of the bus id to
+have their traffic profiled.
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import i2c
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["i2c"]
+
+i2c_profiler_ns = cg.esphome_ns.namespace("i2c_profiler")
+I2CProfiler = i2c_profiler_ns.class_(
+    "I2CProfiler", cg.PollingComponent, i2c.I2CBus
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(I2CProfiler),
+        cv.GenerateID(i2c.CONF_I2C_ID): cv.use_id(i2c.I2CBus),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    # The real bus; components using the profiler's id go through it
+    i2c_bus = await cg.get_variable(config[i2c.CONF_I2C_ID])
+    cg.add(var.set_bus(i2c_bus))
@@ -0,0 +1,213 @@
+/**
+ * I2C Bus Profiler Implementation
+ */
+#include "i2c_profiler.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <cstdio>
+
+namespace esphome {
+namespace i2c_profiler {
+
+static const char *const TAG = "i2c_profiler";
+
+void I2CTrafficStats::record(size_t bytes, bool write, bool nack, uint32_t latency_us) {
+  this->transactions++;
+  if (write) {
+    this->writes++;
+  } else {
+    this->reads++;
+  }
+  if (nack) {
+    this->nacks++;
+  }
+  this->bytes += bytes;
+  this->busy_us += latency_us;
+  if (latency_us > this->latency_max_us) {
+    this->latency_max_us = latency_us;
+  }
+
+  uint8_t bucket = 0;
+  uint32_t bound = I2C_PROFILER_FIRST_BUCKET_US;
+  while (bucket < I2C_PROFILER_BUCKETS - 1 && latency_us >= bound) {
+    bucket++;
+    bound <<= 1;
+  }
+  this->histogram[bucket]++;
+}
+
+uint32_t I2CTrafficStats::latency_percentile_us(uint8_t percent) const {
+  if (this->transactions == 0) {
+    return 0;
+  }
+  // Rank of the percentile sample, rounded up (1-based)
+  uint32_t rank = (uint32_t) (((uint64_t) this->transactions * percent + 99) / 100);
+  uint32_t seen = 0;
+  uint32_t bound = I2C_PROFILER_FIRST_BUCKET_US;
+  for (uint8_t i = 0; i < I2C_PROFILER_BUCKETS - 1; i++) {
+    seen += this->histogram[i];
+    if (seen >= rank) {
+      return bound;
+    }
+    bound <<= 1;
+  }
+  return UINT32_MAX;
+}
+
+void I2CProfiler::setup() {
+  if (this->bus_ == nullptr) {
+    ESP_LOGE(TAG, "No I2C bus to profile");
+    this->mark_failed();
+    return;
+  }
+  this->window_start_us_ = micros();
+}
+
+void I2CProfiler::set_device_sensor(uint8_t address, ProfileMetric metric, sensor::Sensor *sensor) {
+  I2CDeviceProfile *profile = this->profile_(address);
+  if (profile != nullptr) {
+    profile->sensors[metric] = sensor;
+  }
+}
+
+i2c::ErrorCode I2CProfiler::write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count,
+                                        uint8_t *read_buffer, size_t read_count) {
+  if (this->bus_ == nullptr) {
+    return i2c::ERROR_NOT_INITIALIZED;
+  }
+  uint32_t start = micros();
+  i2c::ErrorCode err = this->bus_->write_readv(address, write_buffer, write_count, read_buffer, read_count);
+  // A register read (pointer write + read) counts as a read
+  this->record_(address, write_count + read_count, read_count == 0, err, start);
+  return err;
+}
+
+void I2CProfiler::record_(uint8_t address, size_t bytes, bool write, i2c::ErrorCode err, uint32_t start_us) {
+  uint32_t latency = micros() - start_us;
+  bool nack = err != i2c::ERROR_OK;
+
+  this->bus_profile_.total.record(bytes, write, nack, latency);
+  this->bus_profile_.window.record(bytes, write, nack, latency);
+
+  I2CDeviceProfile *profile = this->profile_(address);
+  if (profile == nullptr) {
+    this->untracked_transactions_++;
+    return;
+  }
+  profile->total.record(bytes, write, nack, latency);
+  profile->window.record(bytes, write, nack, latency);
+}
+
+I2CDeviceProfile *I2CProfiler::profile_(uint8_t address) {
+  for (auto &profile : this->devices_) {
+    if (profile.address == address) {
+      return &profile;
+    }
+  }
+  if (this->devices_.size() >= I2C_PROFILER_MAX_DEVICES) {
+    return nullptr;
+  }
+  // Reserve up front so profile pointers stay valid as devices appear
+  if (this->devices_.capacity() < I2C_PROFILER_MAX_DEVICES) {
+    this->devices_.reserve(I2C_PROFILER_MAX_DEVICES);
+  }
+  this->devices_.emplace_back();
+  this->devices_.back().address = address;
+  return &this->devices_.back();
+}
+
+const I2CDeviceProfile *I2CProfiler::get_device_profile(uint8_t address) const {
+  for (const auto &profile : this->devices_) {
+    if (profile.address == address) {
+      return &profile;
+    }
+  }
+  return nullptr;
+}
+
+void I2CProfiler::update() {
+  uint32_t now = micros();
+  uint32_t window_us = now - this->window_start_us_;
+  this->window_start_us_ = now;
+  this->uptime_us_ += window_us;
+  if (window_us == 0) {
+    return;
+  }
+
+  this->log_stats_("Bus", this->bus_profile_.window, window_us);
+  this->publish_(this->bus_profile_, window_us);
+  for (auto &profile : this->devices_) {
+    char label[8];
+    snprintf(label, sizeof(label), "0x%02X", profile.address);
+    this->log_stats_(label, profile.window, window_us);
+    this->publish_(profile, window_us);
+  }
+}
+
+void I2CProfiler::publish_(I2CDeviceProfile &profile, uint32_t window_us) {
+  const I2CTrafficStats &window = profile.window;
+  float seconds = window_us / 1e6f;
+  float values[METRIC_COUNT] = {
+      window.transactions / seconds,
+      window.bytes / seconds,
+      (float) profile.total.nacks,
+      (float) window.latency_avg_us(),
+      (float) window.latency_max_us,
+      window.busy_us * 100.0f / window_us,
+  };
+  for (uint8_t i = 0; i < METRIC_COUNT; i++) {
+    if (profile.sensors[i] != nullptr) {
+      profile.sensors[i]->publish_state(values[i]);
+    }
+  }
+  profile.window = I2CTrafficStats();
+}
+
+void I2CProfiler::log_stats_(const char *label, const I2CTrafficStats &stats, uint32_t elapsed_us) const {
+  ESP_LOGD(TAG, "%s: %u transactions (%u NACK), %u bytes, latency avg %u us / max %u us, busy %.1f%%", label,
+           (unsigned) stats.transactions, (unsigned) stats.nacks, (unsigned) stats.bytes,
+           (unsigned) stats.latency_avg_us(), (unsigned) stats.latency_max_us,
+           elapsed_us > 0 ? stats.busy_us * 100.0f / elapsed_us : 0.0f);
+}
+
+void I2CProfiler::dump_config() {
+  ESP_LOGCONFIG(TAG, "I2C Profiler:");
+  LOG_UPDATE_INTERVAL(this);
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "  No I2C bus configured!");
+    return;
+  }
+
+  uint64_t uptime_us = this->uptime_us_ + (uint32_t) (micros() - this->window_start_us_);
+  const I2CTrafficStats &bus = this->bus_profile_.total;
+  ESP_LOGCONFIG(TAG, "  Bus: %u transactions, %u bytes, %u NACKs, busy %.1f%% since boot",
+                (unsigned) bus.transactions, (unsigned) bus.bytes, (unsigned) bus.nacks,
+                uptime_us > 0 ? bus.busy_us * 100.0f / uptime_us : 0.0f);
+
+  for (const auto &profile : this->devices_) {
+    const I2CTrafficStats &stats = profile.total;
+    ESP_LOGCONFIG(TAG, "  Device 0x%02X: %u transactions (%u reads, %u writes), %u bytes, %u NACKs",
+                  profile.address, (unsigned) stats.transactions, (unsigned) stats.reads, (unsigned) stats.writes,
+                  (unsigned) stats.bytes, (unsigned) stats.nacks);
+    uint32_t p95 = stats.latency_percentile_us(95);
+    char p95_text[16];
+    if (p95 == UINT32_MAX) {
+      snprintf(p95_text, sizeof(p95_text), ">=%u", (unsigned) (I2C_PROFILER_FIRST_BUCKET_US << (I2C_PROFILER_BUCKETS - 2)));
+    } else {
+      snprintf(p95_text, sizeof(p95_text), "<%u", (unsigned) p95);
+    }
+    ESP_LOGCONFIG(TAG, "    Latency: avg %u us, p95 %s us, max %u us, busy %.1f%%", (unsigned) stats.latency_avg_us(),
+                  p95_text, (unsigned) stats.latency_max_us, uptime_us > 0 ? stats.busy_us * 100.0f / uptime_us : 0.0f);
+    ESP_LOGCONFIG(TAG, "    Histogram: <32us %u | <64 %u | <128 %u | <256 %u | <512 %u | <1ms %u | <2ms %u | >=2ms %u",
+                  (unsigned) stats.histogram[0], (unsigned) stats.histogram[1], (unsigned) stats.histogram[2],
+                  (unsigned) stats.histogram[3], (unsigned) stats.histogram[4], (unsigned) stats.histogram[5],
+                  (unsigned) stats.histogram[6], (unsigned) stats.histogram[7]);
+  }
+  if (this->untracked_transactions_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Untracked: %u transactions to addresses beyond the first %u",
+                  (unsigned) this->untracked_transactions_, I2C_PROFILER_MAX_DEVICES);
+  }
+}
+
+}  // namespace i2c_profiler
+}  // namespace esphome
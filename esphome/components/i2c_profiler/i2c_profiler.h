@@ -0,0 +1,106 @@
+/**
+ * I2C Bus Profiler Component for ESPHome
+ *
+ * Sits between the I2C bus and the components using it: the profiler is an
+ * i2c::I2CBus itself and forwards every transaction to the real bus, timing
+ * it and recording it against the target address.
+ *
+ * Per address (and for the whole bus) it keeps transactions, bytes, NACKs,
+ * a latency histogram and the time spent on the bus. Each update interval
+ * the window figures are published to the configured sensors and logged;
+ * lifetime totals are printed by dump_config.
+ */
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/i2c/i2c.h"
+#include "esphome/components/sensor/sensor.h"
+#include <array>
+#include <vector>
+
+namespace esphome {
+namespace i2c_profiler {
+
+// Latency histogram: bucket 0 is < 32 us, each next bucket doubles the bound,
+// the last bucket (>= 2048 us) is open-ended
+constexpr uint8_t I2C_PROFILER_BUCKETS = 8;
+constexpr uint32_t I2C_PROFILER_FIRST_BUCKET_US = 32;
+
+// Distinct device addresses tracked individually (the bus totals cover all)
+constexpr uint8_t I2C_PROFILER_MAX_DEVICES = 16;
+
+enum ProfileMetric : uint8_t {
+  METRIC_TRANSACTIONS = 0,  // Transactions per second
+  METRIC_BYTES,             // Payload bytes per second
+  METRIC_NACKS,             // Failed transactions since boot
+  METRIC_LATENCY,           // Average transaction time (us)
+  METRIC_LATENCY_MAX,       // Longest transaction time (us)
+  METRIC_UTILIZATION,       // Share of wall time spent in bus calls (%)
+  METRIC_COUNT,
+};
+
+struct I2CTrafficStats {
+  uint32_t transactions{0};
+  uint32_t reads{0};
+  uint32_t writes{0};
+  uint32_t nacks{0};
+  uint64_t bytes{0};
+  uint64_t busy_us{0};
+  uint32_t latency_max_us{0};
+  std::array<uint32_t, I2C_PROFILER_BUCKETS> histogram{};
+
+  void record(size_t bytes, bool write, bool nack, uint32_t latency_us);
+  uint32_t latency_avg_us() const {
+    return this->transactions > 0 ? (uint32_t) (this->busy_us / this->transactions) : 0;
+  }
+  // Upper bound of the histogram bucket holding the given percentile (0 if empty,
+  // UINT32_MAX if it falls in the open-ended bucket)
+  uint32_t latency_percentile_us(uint8_t percent) const;
+};
+
+struct I2CDeviceProfile {
+  uint8_t address{0};
+  I2CTrafficStats total;   // Since boot
+  I2CTrafficStats window;  // Since the last update()
+  std::array<sensor::Sensor *, METRIC_COUNT> sensors{};
+};
+
+class I2CProfiler : public PollingComponent, public i2c::I2CBus {
+ public:
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  // Configuration (called from Python codegen)
+  void set_bus(i2c::I2CBus *bus) { this->bus_ = bus; }
+  void set_sensor(ProfileMetric metric, sensor::Sensor *sensor) { this->bus_profile_.sensors[metric] = sensor; }
+  void set_device_sensor(uint8_t address, ProfileMetric metric, sensor::Sensor *sensor);
+
+  // i2c::I2CBus: forward to the wrapped bus and record
+  // (ESPHome 2025.12+: write_readv is the one transaction virtual; read(),
+  // write() and register access are helpers on top of it)
+  i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                             size_t read_count) override;
+
+  // Profiles (nullptr for an address never seen)
+  const I2CDeviceProfile &get_bus_profile() const { return this->bus_profile_; }
+  const I2CDeviceProfile *get_device_profile(uint8_t address) const;
+  uint32_t get_untracked_transactions() const { return this->untracked_transactions_; }
+
+ protected:
+  I2CDeviceProfile *profile_(uint8_t address);
+  void record_(uint8_t address, size_t bytes, bool write, i2c::ErrorCode err, uint32_t start_us);
+  void publish_(I2CDeviceProfile &profile, uint32_t window_us);
+  void log_stats_(const char *label, const I2CTrafficStats &stats, uint32_t elapsed_us) const;
+
+  i2c::I2CBus *bus_{nullptr};
+  I2CDeviceProfile bus_profile_;
+  std::vector<I2CDeviceProfile> devices_;
+  uint32_t untracked_transactions_{0};  // Addresses beyond I2C_PROFILER_MAX_DEVICES
+  uint64_t uptime_us_{0};  // Closed update windows; micros() wraps every ~71 minutes
+  uint32_t window_start_us_{0};
+};
+
+}  // namespace i2c_profiler
+}  // namespace esphome
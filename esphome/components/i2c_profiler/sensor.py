@@ -0,0 +1,78 @@
+"""Sensor Platform for the I2C Bus Profiler.
+
+Without an address the sensors cover the whole bus; with one they cover
+that device only.
+"""
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ADDRESS,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MICROSECOND,
+    UNIT_PERCENT,
+)
+from . import i2c_profiler_ns, I2CProfiler
+
+DEPENDENCIES = ["i2c_profiler"]
+
+CONF_I2C_PROFILER_ID = "i2c_profiler_id"
+CONF_TRANSACTIONS = "transactions"
+CONF_BYTES = "bytes"
+CONF_NACKS = "nacks"
+CONF_LATENCY = "latency"
+CONF_LATENCY_MAX = "latency_max"
+CONF_UTILIZATION = "utilization"
+
+ProfileMetric = i2c_profiler_ns.enum("ProfileMetric")
+
+METRICS = {
+    CONF_TRANSACTIONS: ProfileMetric.METRIC_TRANSACTIONS,
+    CONF_BYTES: ProfileMetric.METRIC_BYTES,
+    CONF_NACKS: ProfileMetric.METRIC_NACKS,
+    CONF_LATENCY: ProfileMetric.METRIC_LATENCY,
+    CONF_LATENCY_MAX: ProfileMetric.METRIC_LATENCY_MAX,
+    CONF_UTILIZATION: ProfileMetric.METRIC_UTILIZATION,
+}
+
+
+def _diagnostic(unit, icon, accuracy=0, state_class=STATE_CLASS_MEASUREMENT):
+    kwargs = {"unit_of_measurement": unit} if unit else {}
+    return sensor.sensor_schema(
+        icon=icon,
+        accuracy_decimals=accuracy,
+        state_class=state_class,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        **kwargs,
+    )
+
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_I2C_PROFILER_ID): cv.use_id(I2CProfiler),
+        # Device to report on; omit for whole-bus figures
+        cv.Optional(CONF_ADDRESS): cv.i2c_address,
+        cv.Optional(CONF_TRANSACTIONS): _diagnostic("tx/s", "mdi:swap-horizontal", 1),
+        cv.Optional(CONF_BYTES): _diagnostic("B/s", "mdi:counter", 0),
+        cv.Optional(CONF_NACKS): _diagnostic(
+            None, "mdi:alert-circle-outline", 0, STATE_CLASS_TOTAL_INCREASING
+        ),
+        cv.Optional(CONF_LATENCY): _diagnostic(UNIT_MICROSECOND, "mdi:timer-outline"),
+        cv.Optional(CONF_LATENCY_MAX): _diagnostic(UNIT_MICROSECOND, "mdi:timer-alert-outline"),
+        cv.Optional(CONF_UTILIZATION): _diagnostic(UNIT_PERCENT, "mdi:gauge", 1),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_I2C_PROFILER_ID])
+    for key, metric in METRICS.items():
+        if key not in config:
+            continue
+        sens = await sensor.new_sensor(config[key])
+        if CONF_ADDRESS in config:
+            cg.add(parent.set_device_sensor(config[CONF_ADDRESS], metric, sens))
+        else:
+            cg.add(parent.set_sensor(metric, sens))
@@ -4,7 +4,7 @@ Controls IS31FL3737 LED matrix for preset buttons and mode indicators.
 """
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import i2c
+from esphome.components import i2c, i2c_arbiter
 from esphome.const import CONF_ID
 
 DEPENDENCIES = ["i2c"]
@@ -21,6 +21,7 @@ CONFIG_SCHEMA = cv.Schema(
         cv.GenerateID(): cv.declare_id(PanelLEDs),
         cv.GenerateID(i2c.CONF_I2C_ID): cv.use_id(i2c.I2CBus),
         cv.Optional(CONF_BRIGHTNESS, default=128): cv.int_range(min=0, max=255),
+        cv.Optional(i2c_arbiter.CONF_I2C_ARBITER_ID): cv.use_id(i2c_arbiter.I2CArbiter),
     }
 ).extend(cv.COMPONENT_SCHEMA).extend(i2c.i2c_device_schema(0x55))
 
@@ -36,3 +37,4 @@ async def to_code(config):
     
     # Set brightness
     cg.add(var.set_brightness(config[CONF_BRIGHTNESS]))
+    await i2c_arbiter.register_arbiter_client(var, config)
@@ -57,7 +57,17 @@ void PanelLEDs::setup() {
 }
 
 void PanelLEDs::loop() {
-  // Nothing to do in loop - LEDs are set on-demand
+  // Setters only request a push; one flush per loop covers all of them
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    if (!this->driver_->is_show_pending() && this->driver_->start_flush()) {
+      IS31FL3737Driver *driver = this->driver_.get();
+      this->arbiter_->submit_bulk([driver]() { return driver->show_step(); });
+    }
+    return;
+  }
+#endif
+  this->driver_->flush();
 }
 
 void PanelLEDs::dump_config() {
@@ -66,6 +76,16 @@ void PanelLEDs::dump_config() {
   ESP_LOGCONFIG(TAG, "  Brightness: %d", this->brightness_);
   ESP_LOGCONFIG(TAG, "  Preset LEDs: 8");
   ESP_LOGCONFIG(TAG, "  Mode LEDs: 4");
+  if (this->driver_) {
+    const retrotext_display::IS31FL3737Stats &stats = this->driver_->get_stats();
+    ESP_LOGCONFIG(TAG, "  I2C: %u frames (%u unchanged), %u bytes in %u writes, saved %d bytes / %d writes",
+                  (unsigned) stats.frames, (unsigned) stats.frames_unchanged, (unsigned) stats.bytes_written,
+                  (unsigned) stats.transactions, (int) stats.bytes_saved(), (int) stats.transactions_saved());
+    ESP_LOGCONFIG(TAG, "  Bus: %u writes, %u page selects (%u skipped)",
+                  (unsigned) stats.bus_writes, (unsigned) stats.page_selects, (unsigned) stats.page_selects_skipped);
+    ESP_LOGCONFIG(TAG, "  Updates: %u requests in %u flushes (%u pushes avoided)",
+                  (unsigned) stats.show_requests, (unsigned) stats.flushes, (unsigned) stats.flushes_avoided());
+  }
   
   if (this->is_failed()) {
     ESP_LOGE(TAG, "  FAILED - Communication error");
@@ -85,7 +105,7 @@ void PanelLEDs::set_preset_led(uint8_t preset_index, bool on) {
   const LEDPosition &led = PRESET_LEDS[preset_index];
   uint8_t brightness = on ? this->brightness_ : 0;
   this->driver_->set_pixel(led.cs, led.sw, brightness);
-  this->driver_->show();
+  this->driver_->request_show();
   
   ESP_LOGD(TAG, "Preset LED %d: %s", preset_index, on ? "ON" : "OFF");
 }
@@ -96,7 +116,7 @@ void PanelLEDs::set_all_preset_leds(bool on) {
     uint8_t brightness = on ? this->brightness_ : 0;
     this->driver_->set_pixel(led.cs, led.sw, brightness);
   }
-  this->driver_->show();
+  this->driver_->request_show();
   
   ESP_LOGD(TAG, "All preset LEDs: %s", on ? "ON" : "OFF");
 }
@@ -115,7 +135,7 @@ void PanelLEDs::set_active_preset(uint8_t preset_index) {
   // Turn on only the active preset
   const LEDPosition &led = PRESET_LEDS[preset_index];
   this->driver_->set_pixel(led.cs, led.sw, this->brightness_);
-  this->driver_->show();
+  this->driver_->request_show();
   
   this->active_preset_ = preset_index;
   ESP_LOGI(TAG, "Active preset: %d", preset_index);
@@ -129,7 +149,7 @@ void PanelLEDs::set_mode_led(uint8_t mode_index, bool on) {
   const LEDPosition &led = MODE_LEDS[mode_index];
   uint8_t brightness = on ? this->brightness_ : 0;
   this->driver_->set_pixel(led.cs, led.sw, brightness);
-  this->driver_->show();
+  this->driver_->request_show();
   
   ESP_LOGD(TAG, "Mode LED %d: %s", mode_index, on ? "ON" : "OFF");
 }
@@ -140,14 +160,14 @@ void PanelLEDs::set_all_mode_leds(bool on) {
     uint8_t brightness = on ? this->brightness_ : 0;
     this->driver_->set_pixel(led.cs, led.sw, brightness);
   }
-  this->driver_->show();
+  this->driver_->request_show();
   
   ESP_LOGD(TAG, "All mode LEDs: %s", on ? "ON" : "OFF");
 }
 
 void PanelLEDs::clear_all() {
   this->driver_->clear();
-  this->driver_->show();
+  this->driver_->request_show();
   this->active_preset_ = 255;
   ESP_LOGD(TAG, "Cleared all LEDs");
 }
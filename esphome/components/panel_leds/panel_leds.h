@@ -13,6 +13,10 @@
 #include "esphome/components/retrotext_display/is31fl3737_driver.h"
 #include <memory>
 
+#ifdef USE_I2C_ARBITER
+#include "esphome/components/i2c_arbiter/i2c_arbiter.h"
+#endif
+
 namespace esphome {
 namespace panel_leds {
 
@@ -29,6 +33,10 @@ class PanelLEDs : public Component, public i2c::I2CDevice {
   // Configuration
   void set_i2c_bus(i2c::I2CBus *bus) { this->i2c_bus_ = bus; }
   void set_brightness(uint8_t brightness) { this->brightness_ = brightness; }
+#ifdef USE_I2C_ARBITER
+  // Pushes go out as bulk jobs on the arbiter
+  void set_i2c_arbiter(i2c_arbiter::I2CArbiter *arbiter) { this->arbiter_ = arbiter; }
+#endif
 
   // Public API
   void set_preset_led(uint8_t preset_index, bool on);
@@ -43,6 +51,9 @@ class PanelLEDs : public Component, public i2c::I2CDevice {
   uint8_t brightness_{128};
   std::unique_ptr<IS31FL3737Driver> driver_;
   uint8_t active_preset_{255};  // 255 = none active
+#ifdef USE_I2C_ARBITER
+  i2c_arbiter::I2CArbiter *arbiter_{nullptr};
+#endif
 };
 
 }  // namespace panel_leds
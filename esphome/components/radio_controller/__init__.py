@@ -1,8 +1,9 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import tca8418_keypad, retrotext_display, select, i2c
+from esphome.components import tca8418_keypad, retrotext_display, select, i2c, i2c_arbiter
 from esphome.components import text_sensor as text_sensor_component
 from esphome.const import CONF_ID, CONF_ICON
+from esphome.core import CORE
 from esphome import automation
 
 DEPENDENCIES = ['tca8418_keypad', 'retrotext_display']
@@ -26,6 +27,39 @@ CONF_DATA = 'data'
 CONF_CONTROLS = 'controls'
 CONF_ENCODER_BUTTON = 'encoder_button'
 CONF_MEMORY_BUTTON = 'memory_button'
+CONF_HARDWARE_FADES = 'hardware_fades'
+CONF_ENCODER_ACCELERATION = 'encoder_acceleration'
+CONF_CURVE = 'curve'
+CONF_BELOW = 'below'
+CONF_STEP = 'step'
+CONF_SPIN_SETTLE = 'spin_settle'
+CONF_SPIN_REDRAW_INTERVAL = 'spin_redraw_interval'
+CONF_FAVORITES_PAGING = 'favorites_paging'
+CONF_PAGE_SIZE = 'page_size'
+CONF_WINDOW_PAGES = 'window_pages'
+CONF_PREFETCH = 'prefetch'
+CONF_EVENT = 'event'
+
+# Must match ENCODER_STEP_GROUP in encoder_acceleration.h
+ENCODER_STEP_GROUP = 0
+
+# Must match KeyAction and the KEY_DISPATCH_* sizes in key_dispatch.h
+KEY_ACTION_PRESET = 0x10
+KEY_ACTION_ENCODER_A = 0x20
+KEY_ACTION_ENCODER_B = 0x30
+KEY_ACTION_ENCODER_BUTTON = 0x40
+KEY_ACTION_MEMORY = 0x50
+KEY_ACTION_MODE = 0x60
+KEY_DISPATCH_COLUMNS = 10
+KEY_DISPATCH_SIZE = 80
+
+# Fixed panel wiring: encoder channels A/B are columns 2/3 of the encoder
+# button's row, the mode selector is row 0 columns 5-8
+ENCODER_A_COLUMN = 2
+ENCODER_B_COLUMN = 3
+MODE_SELECTOR_ROW = 0
+MODE_SELECTOR_COLUMN = 5
+MODE_SELECTOR_POSITIONS = 4
 
 BUTTON_SCHEMA = cv.Schema({
     cv.Required(CONF_ROW): cv.int_range(min=0, max=7),
@@ -46,6 +80,47 @@ PRESET_SCHEMA = cv.Schema({
     cv.Optional(CONF_NAME): cv.string,
 })
 
+def encoder_step(value):
+    """Items per detent, or 'group' to jump to the next alphabetical group."""
+    if isinstance(value, str) and value.lower() == 'group':
+        return ENCODER_STEP_GROUP
+    return cv.int_range(min=1, max=100)(value)
+
+
+ACCELERATION_POINT_SCHEMA = cv.Schema({
+    # Applies when detents come closer together than this
+    cv.Required(CONF_BELOW): cv.positive_time_period_milliseconds,
+    cv.Required(CONF_STEP): encoder_step,
+})
+
+ACCELERATION_SCHEMA = cv.Schema({
+    cv.Optional(CONF_CURVE, default=[
+        {CONF_BELOW: '120ms', CONF_STEP: 2},
+        {CONF_BELOW: '60ms', CONF_STEP: 5},
+        {CONF_BELOW: '30ms', CONF_STEP: 'group'},
+    ]): cv.All(cv.ensure_list(ACCELERATION_POINT_SCHEMA), cv.Length(min=1)),
+    # The landing item is drawn once no detent came for this long
+    cv.Optional(CONF_SPIN_SETTLE, default='150ms'): cv.positive_time_period_milliseconds,
+    # Progress redraws while spinning (0ms = landing item only)
+    cv.Optional(CONF_SPIN_REDRAW_INTERVAL, default='300ms'): cv.positive_time_period_milliseconds,
+})
+
+def validate_favorites_paging(config):
+    if config[CONF_PREFETCH] >= config[CONF_PAGE_SIZE]:
+        raise cv.Invalid(f"{CONF_PREFETCH} must be less than {CONF_PAGE_SIZE}")
+    return config
+
+
+FAVORITES_PAGING_SCHEMA = cv.All(cv.Schema({
+    # Home Assistant event asking for a page (default esphome.<device name>_favorites_page)
+    cv.Optional(CONF_EVENT): cv.string,
+    cv.Optional(CONF_PAGE_SIZE, default=25): cv.int_range(min=5, max=200),
+    # Pages kept around the selection (at least the page being browsed and the next)
+    cv.Optional(CONF_WINDOW_PAGES, default=4): cv.int_range(min=2, max=16),
+    # The next page is requested this many items before the window edge
+    cv.Optional(CONF_PREFETCH, default=8): cv.int_range(min=1, max=199),
+}), validate_favorites_paging)
+
 CONTROLS_SCHEMA = cv.Schema({
     cv.Optional(CONF_ENCODER_BUTTON): BUTTON_SCHEMA,
     cv.Optional(CONF_MEMORY_BUTTON): BUTTON_SCHEMA,
@@ -56,8 +131,17 @@ CONFIG_SCHEMA = cv.Schema({
     cv.Required(CONF_KEYPAD_ID): cv.use_id(tca8418_keypad.TCA8418Component),
     cv.Required(CONF_DISPLAY_ID): cv.use_id(retrotext_display.RetroTextDisplay),
     cv.Optional(CONF_I2C_ID): cv.use_id(i2c.I2CBus),
-    cv.Optional(CONF_PRESETS, default=[]): cv.ensure_list(PRESET_SCHEMA),
+    # Panel LED fades/pulses on the IS31FL3737 auto breath engine (false = software animation)
+    cv.Optional(CONF_HARDWARE_FADES, default=True): cv.boolean,
+    # Panel LED pushes go out as arbiter bulk jobs
+    cv.Optional(i2c_arbiter.CONF_I2C_ARBITER_ID): cv.use_id(i2c_arbiter.I2CArbiter),
+    # Slot numbers must fit the dispatch table's 4-bit argument
+    cv.Optional(CONF_PRESETS, default=[]): cv.All(cv.ensure_list(PRESET_SCHEMA), cv.Length(max=16)),
     cv.Optional(CONF_CONTROLS): CONTROLS_SCHEMA,
+    # Velocity-aware encoder scrolling (off when not configured)
+    cv.Optional(CONF_ENCODER_ACCELERATION): ACCELERATION_SCHEMA,
+    # Page favorites in from Home Assistant instead of loading the whole list
+    cv.Optional(CONF_FAVORITES_PAGING): FAVORITES_PAGING_SCHEMA,
     # Default service to call for all presets (can be overridden per-preset)
     cv.Optional(CONF_SERVICE, default="script.radio_play_preset"): cv.string,
     # Mode selector text sensor
@@ -80,12 +164,40 @@ SELECT_SCHEMA = select.select_schema(
 })
 
 
+def build_key_map(config):
+    """Action byte for every key of the 8x10 matrix (see key_dispatch.h).
+
+    Written lowest priority first so overlapping keys resolve the way the
+    controller always checked them: encoder A/B, memory button, mode selector,
+    presets (first listed wins), encoder button.
+    """
+    key_map = [0] * KEY_DISPATCH_SIZE
+
+    def assign(row, column, action):
+        key_map[row * KEY_DISPATCH_COLUMNS + column] = action
+
+    controls = config.get(CONF_CONTROLS, {})
+    encoder = controls.get(CONF_ENCODER_BUTTON)
+    if encoder is not None:
+        assign(encoder[CONF_ROW], encoder[CONF_COLUMN], KEY_ACTION_ENCODER_BUTTON)
+    for slot in reversed(range(len(config[CONF_PRESETS]))):
+        button = config[CONF_PRESETS][slot][CONF_BUTTON]
+        assign(button[CONF_ROW], button[CONF_COLUMN], KEY_ACTION_PRESET | slot)
+    for mode in range(MODE_SELECTOR_POSITIONS):
+        assign(MODE_SELECTOR_ROW, MODE_SELECTOR_COLUMN + mode, KEY_ACTION_MODE | mode)
+    memory = controls.get(CONF_MEMORY_BUTTON)
+    if memory is not None:
+        assign(memory[CONF_ROW], memory[CONF_COLUMN], KEY_ACTION_MEMORY)
+    if encoder is not None:
+        assign(encoder[CONF_ROW], ENCODER_A_COLUMN, KEY_ACTION_ENCODER_A)
+        assign(encoder[CONF_ROW], ENCODER_B_COLUMN, KEY_ACTION_ENCODER_B)
+    return key_map
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     
-    # ArduinoJson is provided by ESPHome core (6.x)
-    
     # Get references to keypad and display
     keypad = await cg.get_variable(config[CONF_KEYPAD_ID])
     display = await cg.get_variable(config[CONF_DISPLAY_ID])
@@ -97,6 +209,8 @@ async def to_code(config):
     if CONF_I2C_ID in config:
         i2c_bus = await cg.get_variable(config[CONF_I2C_ID])
         cg.add(var.set_i2c_bus(i2c_bus))
+    cg.add(var.set_hardware_fades(config[CONF_HARDWARE_FADES]))
+    await i2c_arbiter.register_arbiter_client(var, config)
     
     # Set default service
     cg.add(var.set_default_service(config[CONF_SERVICE]))
@@ -143,6 +257,26 @@ async def to_code(config):
             memory = controls[CONF_MEMORY_BUTTON]
             cg.add(var.set_memory_button(memory[CONF_ROW], memory[CONF_COLUMN]))
     
+    # Key routing table, compiled into flash
+    key_map = build_key_map(config)
+    cg.add_define("RADIO_CONTROLLER_KEY_MAP",
+                  cg.RawExpression("{" + ", ".join(f"0x{action:02X}" for action in key_map) + "}"))
+    
+    # Encoder acceleration curve
+    if CONF_ENCODER_ACCELERATION in config:
+        accel = config[CONF_ENCODER_ACCELERATION]
+        for point in accel[CONF_CURVE]:
+            cg.add(var.add_encoder_acceleration(point[CONF_BELOW].total_milliseconds, point[CONF_STEP]))
+        cg.add(var.set_spin_redraw(accel[CONF_SPIN_SETTLE].total_milliseconds,
+                                   accel[CONF_SPIN_REDRAW_INTERVAL].total_milliseconds))
+    
+    # Favorites paging
+    if CONF_FAVORITES_PAGING in config:
+        paging = config[CONF_FAVORITES_PAGING]
+        event = paging.get(CONF_EVENT) or f"esphome.{CORE.name.replace('-', '_')}_favorites_page"
+        cg.add(var.set_favorites_paging(event, paging[CONF_PAGE_SIZE], paging[CONF_WINDOW_PAGES],
+                                        paging[CONF_PREFETCH]))
+    
     # Add mode text sensor if configured
     if "mode_text_sensor" in config:
         mode_sensor = await cg.get_variable(config["mode_text_sensor"])
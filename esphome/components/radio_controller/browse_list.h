@@ -0,0 +1,166 @@
+/**
+ * Unified browse list
+ *
+ * One list of everything the encoder can scroll through: the preset slots,
+ * a separator when there is anything after them, then the playlist and
+ * favorites segments (ordered by type; the separator counts as a preset).
+ * Presets and the separator own their strings; playlist and favorite items
+ * share their source list's, so a reload replaces one segment in place
+ * instead of rebuilding the list.
+ *
+ * Items have stable IDs so the selection and the playing item survive a
+ * reload even when their position moves: preset slots are 1-7 and the
+ * separator 8; playlists and favorites hash their URI. Two entries with the
+ * same URI (or a hash collision) are told apart by position: a later one
+ * takes the next free ID in its segment, which it gets again on the next
+ * reload as long as the order holds.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "string_arena.h"
+
+namespace esphome {
+namespace radio_controller {
+
+constexpr uint8_t BROWSE_PRESET_SLOTS = 7;
+
+constexpr uint32_t BROWSE_ID_NONE = 0;
+constexpr uint32_t BROWSE_ID_SEPARATOR = BROWSE_PRESET_SLOTS + 1;
+constexpr uint32_t BROWSE_ID_HASH_MASK = 0x3FFFFFFF;
+constexpr const char *BROWSE_SEPARATOR_NAME = "--- ALL FAVORITES ---";
+
+// Strings are in the controller's string arena (see string_arena.h)
+struct BrowseItem {
+  enum Type : uint8_t { PRESET, PLAYLIST, FAVORITE };
+  uint32_t id{BROWSE_ID_NONE};
+  Type type{PRESET};
+  int8_t preset_index{-1};   // -1 if not a preset, 0-6 for presets (7 total)
+  uint8_t row{0};            // For presets, original button position
+  uint8_t column{0};
+  ArenaString name;          // Display name
+  ArenaString target;        // Media ID / URI
+};
+
+// Playlist or favorite from Home Assistant; its browse item shares the strings
+struct PlaylistItem {
+  ArenaString name;
+  ArenaString uri;
+};
+
+// FNV-1a of the URI in the low 30 bits, segment in the top two
+inline uint32_t browse_uri_id(BrowseItem::Type type, const char *uri) {
+  uint32_t hash = 2166136261u;
+  for (; *uri != '\0'; uri++) {
+    hash = (hash ^ (uint8_t) *uri) * 16777619u;
+  }
+  return (hash & BROWSE_ID_HASH_MASK) | ((uint32_t) type << 30);
+}
+
+// [first, last) of the segment; empty at its place in the order when absent
+inline std::pair<size_t, size_t> browse_segment(const std::vector<BrowseItem> &items, BrowseItem::Type type) {
+  auto begin = std::lower_bound(items.begin(), items.end(), type,
+                                [](const BrowseItem &item, BrowseItem::Type t) { return item.type < t; });
+  auto end = std::upper_bound(begin, items.end(), type,
+                              [](BrowseItem::Type t, const BrowseItem &item) { return t < item.type; });
+  return {(size_t) (begin - items.begin()), (size_t) (end - items.begin())};
+}
+
+// Position of the item with `id`, trying `hint` first; -1 when not listed
+inline int find_browse_item(const std::vector<BrowseItem> &items, uint32_t id, size_t hint) {
+  if (id == BROWSE_ID_NONE) {
+    return -1;
+  }
+  if (hint < items.size() && items[hint].id == id) {
+    return hint;
+  }
+  for (size_t i = 0; i < items.size(); i++) {
+    if (items[i].id == id) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Points the segment's items at the source strings again (after the arena
+// was compacted); the segment must still match the source
+inline void reshare_browse_segment(std::vector<BrowseItem> &items, BrowseItem::Type type,
+                                   const std::vector<PlaylistItem> &source) {
+  size_t first = browse_segment(items, type).first;
+  for (size_t i = 0; i < source.size(); i++) {
+    items[first + i].name = source[i].name;
+    items[first + i].target = source[i].uri;
+  }
+}
+
+// Makes the segment match `source` in a list that starts with the preset
+// slots, adding or removing the separator, and moves `selected` and `playing`
+// (-1 = none) to where their items went. A selection whose item is gone
+// stays in range; a playing one becomes -1
+inline void replace_browse_segment(std::vector<BrowseItem> &items, BrowseItem::Type type,
+                                   const std::vector<PlaylistItem> &source, StringArena &strings, size_t &selected,
+                                   int &playing) {
+  // Remember the selections by ID; positions move with the segments
+  uint32_t selected_id = selected < items.size() ? items[selected].id : BROWSE_ID_NONE;
+  uint32_t playing_id = playing >= 0 && playing < (int) items.size() ? items[playing].id : BROWSE_ID_NONE;
+
+  // Separator after the preset slots while there is anything after them
+  bool has_separator = items.size() > BROWSE_PRESET_SLOTS && items[BROWSE_PRESET_SLOTS].type == BrowseItem::PRESET;
+  auto range = browse_segment(items, type);
+  size_t others = items.size() - BROWSE_PRESET_SLOTS - has_separator - (range.second - range.first);
+  bool wants_separator = !source.empty() || others > 0;
+  if (wants_separator && !has_separator) {
+    BrowseItem separator;
+    separator.id = BROWSE_ID_SEPARATOR;
+    separator.type = BrowseItem::PRESET;
+    separator.name = strings.add(BROWSE_SEPARATOR_NAME);
+    items.insert(items.begin() + BROWSE_PRESET_SLOTS, separator);
+  } else if (!wants_separator && has_separator) {
+    strings.release(items[BROWSE_PRESET_SLOTS].name);
+    items.erase(items.begin() + BROWSE_PRESET_SLOTS);
+  }
+
+  // The segment's strings belong to its source list (released when it was reloaded)
+  range = browse_segment(items, type);
+  size_t old_size = range.second - range.first;
+  if (source.size() < old_size) {
+    items.erase(items.begin() + range.first + source.size(), items.begin() + range.second);
+  } else if (source.size() > old_size) {
+    items.insert(items.begin() + range.second, source.size() - old_size, BrowseItem{});
+  }
+  std::vector<uint32_t> used;  // IDs given out so far, sorted
+  used.reserve(source.size());
+  for (size_t i = 0; i < source.size(); i++) {
+    uint32_t id = browse_uri_id(type, strings.c_str(source[i].uri));
+    auto slot = std::lower_bound(used.begin(), used.end(), id);
+    while (slot != used.end() && *slot == id) {
+      id = ((id + 1) & BROWSE_ID_HASH_MASK) | ((uint32_t) type << 30);
+      slot = std::lower_bound(used.begin(), used.end(), id);
+    }
+    used.insert(slot, id);
+
+    BrowseItem &item = items[range.first + i];
+    item = BrowseItem{};
+    item.id = id;
+    item.type = type;
+    item.name = source[i].name;
+    item.target = source[i].uri;
+  }
+
+  int found = find_browse_item(items, selected_id, selected);
+  if (found >= 0) {
+    selected = found;
+  } else if (selected >= items.size()) {
+    selected = items.empty() ? 0 : items.size() - 1;
+  }
+  if (playing_id != BROWSE_ID_NONE) {
+    playing = find_browse_item(items, playing_id, playing);
+  }
+}
+
+}  // namespace radio_controller
+}  // namespace esphome
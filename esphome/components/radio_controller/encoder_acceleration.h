@@ -0,0 +1,97 @@
+/**
+ * Encoder velocity acceleration
+ *
+ * Turns the time between encoder detents into a step size: slow clicks move
+ * one browse item, a fast spin moves several or jumps a whole alphabetical
+ * group. The curve is a list of points "detents closer together than
+ * `below` move `step` items", configured from YAML (`encoder_acceleration`).
+ *
+ * Detent times come from the keypad's read timestamps, so they reflect the
+ * knob and not when the controller got round to handling the events. The
+ * interval is averaged over consecutive detents so one bouncy edge doesn't
+ * trigger a jump; a pause longer than the slowest point or a change of
+ * direction starts over at one item per detent.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace radio_controller {
+
+// Step value meaning "jump to the next alphabetical group"
+constexpr uint16_t ENCODER_STEP_GROUP = 0;
+
+struct EncoderAccelerationPoint {
+  uint32_t below_us;  // Applies when the detent interval is shorter than this
+  uint16_t step;      // Items per detent, or ENCODER_STEP_GROUP
+};
+
+class EncoderAcceleration {
+ public:
+  // Points may be added in any order; they are kept slowest first
+  void add_point(uint32_t below_ms, uint16_t step) {
+    EncoderAccelerationPoint point{below_ms * 1000, step};
+    auto it = this->points_.begin();
+    while (it != this->points_.end() && it->below_us > point.below_us) {
+      ++it;
+    }
+    this->points_.insert(it, point);
+  }
+  bool is_enabled() const { return !this->points_.empty(); }
+  const std::vector<EncoderAccelerationPoint> &get_points() const { return this->points_; }
+
+  // Step for a detent read at timestamp_us turning in direction (+1/-1)
+  uint16_t on_detent(uint32_t timestamp_us, int8_t direction) {
+    uint32_t interval = timestamp_us - this->last_detent_us_;
+    bool continuing = this->has_last_ && direction == this->last_direction_ && this->is_enabled() &&
+                      interval < this->points_.front().below_us;
+    this->last_detent_us_ = timestamp_us;
+    this->last_direction_ = direction;
+    this->has_last_ = true;
+    if (!continuing) {
+      this->spinning_ = false;
+      this->interval_us_ = 0;
+      return 1;
+    }
+
+    // Detents stamped together (one keypad drain) carry no rate: keep the
+    // current average, or one item until there is a real interval
+    if (interval != 0) {
+      this->interval_us_ = this->spinning_ ? (this->interval_us_ + interval) / 2 : interval;
+      this->spinning_ = true;
+    }
+    if (!this->spinning_) {
+      return 1;
+    }
+    uint16_t step = 1;
+    for (const auto &point : this->points_) {
+      if (this->interval_us_ < point.below_us) {
+        step = point.step;
+      }
+    }
+    return step;
+  }
+
+  // Detents are coming faster than the slowest point
+  bool is_spinning() const { return this->spinning_; }
+  // Averaged detent interval (0 when not spinning)
+  uint32_t get_interval_us() const { return this->interval_us_; }
+  void reset() {
+    this->has_last_ = false;
+    this->spinning_ = false;
+    this->interval_us_ = 0;
+  }
+
+ protected:
+  std::vector<EncoderAccelerationPoint> points_;
+  uint32_t last_detent_us_{0};
+  uint32_t interval_us_{0};
+  int8_t last_direction_{0};
+  bool has_last_{false};
+  bool spinning_{false};
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
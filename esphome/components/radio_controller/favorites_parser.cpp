@@ -0,0 +1,375 @@
+#include "favorites_parser.h"
+
+namespace esphome {
+namespace radio_controller {
+
+// Length of `length` bytes once a multi-byte UTF-8 sequence cut off at the end is dropped
+static size_t utf8_boundary(const char *text, size_t length) {
+  size_t lead = length;
+  while (lead > 0 && (static_cast<uint8_t>(text[lead - 1]) & 0xC0) == 0x80) {
+    lead--;
+  }
+  if (lead == 0) {
+    return 0;
+  }
+  uint8_t first = static_cast<uint8_t>(text[lead - 1]);
+  size_t needed = first >= 0xF0 ? 4 : first >= 0xE0 ? 3 : first >= 0xC0 ? 2 : 1;
+  return length - (lead - 1) < needed ? lead - 1 : length;
+}
+
+void FavoritesParser::reset() {
+  this->name_length_ = this->uri_length_ = this->key_length_ = 0;
+  this->has_name_ = this->has_uri_ = false;
+  this->name_truncated_ = this->uri_truncated_ = false;
+  this->stack_ = 0;
+  this->depth_ = 0;
+  this->in_string_ = this->escape_ = false;
+  this->unicode_digits_ = 0;
+  this->unicode_ = this->high_surrogate_ = 0;
+  this->expect_key_ = false;
+  this->field_ = this->value_field_ = FIELD_OTHER;
+  this->started_ = this->done_ = false;
+  this->offset_ = 0;
+  this->error_ = nullptr;
+  this->items_ = this->skipped_ = this->truncated_ = 0;
+}
+
+bool FavoritesParser::feed(const char *data, size_t length) {
+  if (this->error_ != nullptr) {
+    return false;
+  }
+  size_t i = 0;
+  while (i < length) {
+    // Most of the payload is string content nobody keeps: skip it in one go
+    if (this->in_string_ && this->field_ == FIELD_OTHER && !this->escape_ && this->unicode_digits_ == 0 &&
+        this->high_surrogate_ == 0) {
+      size_t run = i;
+      while (run < length) {
+        uint8_t c = static_cast<uint8_t>(data[run]);
+        if (c == '"' || c == '\\' || c < 0x20) {
+          break;
+        }
+        run++;
+      }
+      this->offset_ += run - i;
+      i = run;
+      if (i == length) {
+        break;
+      }
+    }
+    if (!this->parse_char_(data[i])) {
+      return false;
+    }
+    this->offset_++;
+    i++;
+  }
+  return true;
+}
+
+bool FavoritesParser::finish() {
+  if (this->error_ != nullptr) {
+    return false;
+  }
+  if (!this->done_) {
+    return this->fail_(this->started_ ? "unexpected end of input" : "empty input");
+  }
+  return true;
+}
+
+bool FavoritesParser::fail_(const char *error) {
+  this->error_ = error;
+  return false;
+}
+
+bool FavoritesParser::parse_char_(char c) {
+  if (this->in_string_) {
+    if (this->unicode_digits_ > 0) {
+      uint8_t digit;
+      if (c >= '0' && c <= '9') {
+        digit = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else {
+        return this->fail_("bad \\u escape");
+      }
+      this->unicode_ = (this->unicode_ << 4) | digit;
+      if (--this->unicode_digits_ == 0) {
+        this->append_(this->unicode_);
+      }
+      return true;
+    }
+    if (this->escape_) {
+      this->escape_ = false;
+      switch (c) {
+        case '"':
+        case '\\':
+        case '/':
+          this->append_(c);
+          return true;
+        case 'b':
+          this->append_('\b');
+          return true;
+        case 'f':
+          this->append_('\f');
+          return true;
+        case 'n':
+          this->append_('\n');
+          return true;
+        case 'r':
+          this->append_('\r');
+          return true;
+        case 't':
+          this->append_('\t');
+          return true;
+        case 'u':
+          this->unicode_digits_ = 4;
+          this->unicode_ = 0;
+          return true;
+        default:
+          return this->fail_("bad escape");
+      }
+    }
+    if (c == '\\') {
+      this->escape_ = true;
+      return true;
+    }
+    if (c == '"') {
+      this->end_string_();
+      return true;
+    }
+    if (static_cast<uint8_t>(c) < 0x20) {
+      return this->fail_("control character in string");
+    }
+    this->flush_surrogate_();
+    this->append_byte_(c);
+    return true;
+  }
+
+  switch (c) {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      return true;
+    case '[':
+      return this->open_(false);
+    case '{':
+      return this->open_(true);
+    case ']':
+      return this->close_(false);
+    case '}':
+      return this->close_(true);
+    case '"':
+      if (this->depth_ == 0) {
+        return this->fail_(this->done_ ? "trailing data" : "not an array");
+      }
+      this->begin_string_();
+      return true;
+    case ':':
+      return this->in_object_() ? true : this->fail_("unexpected ':'");
+    case ',':
+      if (this->depth_ == 0) {
+        return this->fail_("unexpected ','");
+      }
+      this->expect_key_ = this->in_object_();
+      return true;
+    default:
+      // Numbers, true, false, null: nothing here is kept
+      if (this->depth_ == 0) {
+        return this->fail_(this->done_ ? "trailing data" : "not an array");
+      }
+      if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '+' ||
+          c == '.') {
+        return true;
+      }
+      return this->fail_("unexpected character");
+  }
+}
+
+bool FavoritesParser::open_(bool object) {
+  if (this->depth_ == 0) {
+    if (this->done_) {
+      return this->fail_("trailing data");
+    }
+    if (object) {
+      return this->fail_("not an array");
+    }
+    this->started_ = true;
+  }
+  if (this->depth_ >= FAVORITES_MAX_DEPTH) {
+    return this->fail_("nested too deep");
+  }
+  if (object && this->depth_ == 1) {
+    // New item
+    this->has_name_ = this->has_uri_ = false;
+    this->value_field_ = FIELD_OTHER;
+  }
+  if (object) {
+    this->stack_ |= 1UL << this->depth_;
+  } else {
+    this->stack_ &= ~(1UL << this->depth_);
+  }
+  this->depth_++;
+  this->expect_key_ = object;
+  return true;
+}
+
+bool FavoritesParser::close_(bool object) {
+  if (this->depth_ == 0 || this->in_object_() != object) {
+    return this->fail_("mismatched bracket");
+  }
+  this->depth_--;
+  this->expect_key_ = false;
+  if (object && this->depth_ == 1) {
+    this->end_item_();
+  }
+  if (this->depth_ == 0) {
+    this->done_ = true;
+  }
+  return true;
+}
+
+void FavoritesParser::begin_string_() {
+  this->in_string_ = true;
+  this->field_ = FIELD_OTHER;
+  bool key = this->expect_key_;
+  this->expect_key_ = false;
+  if (this->depth_ != 2 || !this->in_object_()) {
+    return;
+  }
+  // Item level: a key, or the value of the last key
+  if (key) {
+    this->field_ = FIELD_KEY;
+    this->key_length_ = 0;
+    return;
+  }
+  this->field_ = this->value_field_;
+  if (this->field_ == FIELD_NAME) {
+    this->name_length_ = 0;
+    this->name_truncated_ = false;
+  } else if (this->field_ == FIELD_URI) {
+    this->uri_length_ = 0;
+    this->uri_truncated_ = false;
+  }
+}
+
+void FavoritesParser::end_string_() {
+  this->flush_surrogate_();
+  this->in_string_ = false;
+  switch (this->field_) {
+    case FIELD_KEY:
+      if (this->key_length_ == 4 && this->key_[0] == 'n' && this->key_[1] == 'a' && this->key_[2] == 'm' &&
+          this->key_[3] == 'e') {
+        this->value_field_ = FIELD_NAME;
+      } else if (this->key_length_ == 3 && this->key_[0] == 'u' && this->key_[1] == 'r' && this->key_[2] == 'i') {
+        this->value_field_ = FIELD_URI;
+      } else {
+        this->value_field_ = FIELD_OTHER;
+      }
+      break;
+    case FIELD_NAME:
+      if (this->name_truncated_) {
+        this->name_length_ = utf8_boundary(this->name_, this->name_length_);
+      }
+      this->name_[this->name_length_] = '\0';
+      this->has_name_ = true;
+      break;
+    case FIELD_URI:
+      this->uri_[this->uri_length_] = '\0';
+      this->has_uri_ = true;
+      break;
+    default:
+      break;
+  }
+  if (this->field_ != FIELD_KEY) {
+    this->value_field_ = FIELD_OTHER;
+  }
+  this->field_ = FIELD_OTHER;
+}
+
+void FavoritesParser::flush_surrogate_() {
+  if (this->high_surrogate_ != 0) {
+    // Unpaired high surrogate
+    this->high_surrogate_ = 0;
+    this->append_(0xFFFD);
+  }
+}
+
+void FavoritesParser::append_(uint32_t code_point) {
+  if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+    if (this->high_surrogate_ == 0) {
+      code_point = 0xFFFD;
+    } else {
+      code_point = 0x10000 + ((this->high_surrogate_ - 0xD800) << 10) + (code_point - 0xDC00);
+      this->high_surrogate_ = 0;
+    }
+  } else {
+    this->flush_surrogate_();
+    if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+      this->high_surrogate_ = code_point;
+      return;
+    }
+  }
+
+  if (code_point < 0x80) {
+    this->append_byte_(code_point);
+  } else if (code_point < 0x800) {
+    this->append_byte_(0xC0 | (code_point >> 6));
+    this->append_byte_(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    this->append_byte_(0xE0 | (code_point >> 12));
+    this->append_byte_(0x80 | ((code_point >> 6) & 0x3F));
+    this->append_byte_(0x80 | (code_point & 0x3F));
+  } else {
+    this->append_byte_(0xF0 | (code_point >> 18));
+    this->append_byte_(0x80 | ((code_point >> 12) & 0x3F));
+    this->append_byte_(0x80 | ((code_point >> 6) & 0x3F));
+    this->append_byte_(0x80 | (code_point & 0x3F));
+  }
+}
+
+void FavoritesParser::append_byte_(uint8_t byte) {
+  switch (this->field_) {
+    case FIELD_KEY:
+      if (this->key_length_ < sizeof(this->key_)) {
+        this->key_[this->key_length_++] = byte;
+      }
+      break;
+    case FIELD_NAME:
+      if (this->name_length_ < FAVORITES_NAME_MAX) {
+        this->name_[this->name_length_++] = byte;
+      } else {
+        this->name_truncated_ = true;
+      }
+      break;
+    case FIELD_URI:
+      if (this->uri_length_ < FAVORITES_URI_MAX) {
+        this->uri_[this->uri_length_++] = byte;
+      } else {
+        this->uri_truncated_ = true;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void FavoritesParser::end_item_() {
+  // A cut-off URI would play the wrong thing; a cut-off name only looks short
+  if (!this->has_name_ || !this->has_uri_ || this->uri_truncated_) {
+    this->skipped_++;
+    return;
+  }
+  this->items_++;
+  if (this->name_truncated_) {
+    this->truncated_++;
+  }
+  if (this->on_item_) {
+    this->on_item_(this->name_, this->name_length_, this->uri_, this->uri_length_);
+  }
+}
+
+}  // namespace radio_controller
+}  // namespace esphome
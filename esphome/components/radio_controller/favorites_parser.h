@@ -0,0 +1,101 @@
+/**
+ * Streaming favorites parser
+ *
+ * Reads the JSON that Home Assistant sends to load_all_favorites and
+ * load_playlist_data, an array of objects like
+ *   [{"name": "Radio Paradise", "uri": "library://radio/12", ...}, ...]
+ * one character at a time, and hands each complete name/uri pair to a
+ * callback as soon as its object closes. No document tree is built: the
+ * working memory is this object (one name, one URI and a bracket stack),
+ * whatever the payload size. Input may arrive in chunks split anywhere.
+ *
+ * Other fields and nested values are skipped. Items without a string name
+ * and uri, or whose URI doesn't fit, are counted as skipped; names that
+ * don't fit are truncated on a UTF-8 boundary.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace esphome {
+namespace radio_controller {
+
+// Longest name / URI kept, in bytes
+constexpr size_t FAVORITES_NAME_MAX = 96;
+constexpr size_t FAVORITES_URI_MAX = 192;
+// Deepest nesting accepted (one bit per level in the bracket stack)
+constexpr uint8_t FAVORITES_MAX_DEPTH = 32;
+
+class FavoritesParser {
+ public:
+  // Name and URI are NUL-terminated and only valid during the call
+  using ItemCallback = std::function<void(const char *name, size_t name_length, const char *uri, size_t uri_length)>;
+
+  explicit FavoritesParser(ItemCallback on_item) : on_item_(std::move(on_item)) {}
+
+  void reset();
+  // Parses the next chunk; false once the input is known to be malformed
+  bool feed(const char *data, size_t length);
+  // True when a complete top-level array was read and nothing followed it
+  bool finish();
+
+  uint32_t get_items() const { return this->items_; }
+  uint32_t get_skipped() const { return this->skipped_; }
+  uint32_t get_truncated() const { return this->truncated_; }
+  // Bytes consumed so far, and what went wrong (nullptr if nothing did)
+  size_t get_offset() const { return this->offset_; }
+  const char *get_error() const { return this->error_; }
+
+ protected:
+  enum Field : uint8_t { FIELD_OTHER, FIELD_NAME, FIELD_URI, FIELD_KEY };
+
+  bool fail_(const char *error);
+  bool parse_char_(char c);
+  bool open_(bool object);
+  bool close_(bool object);
+  void begin_string_();
+  void end_string_();
+  void append_(uint32_t code_point);
+  void append_byte_(uint8_t byte);
+  void flush_surrogate_();
+  void end_item_();
+  bool in_object_() const { return this->depth_ > 0 && (this->stack_ >> (this->depth_ - 1)) & 1; }
+
+  ItemCallback on_item_;
+
+  char name_[FAVORITES_NAME_MAX + 1];
+  char uri_[FAVORITES_URI_MAX + 1];
+  char key_[5];  // Long enough to tell "name" and "uri" from anything else
+  uint8_t name_length_{0};
+  uint8_t uri_length_{0};
+  uint8_t key_length_{0};
+  bool has_name_{false};
+  bool has_uri_{false};
+  bool name_truncated_{false};
+  bool uri_truncated_{false};
+
+  // Lexer state
+  uint32_t stack_{0};  // Bit per level: 1 = object, 0 = array
+  uint8_t depth_{0};
+  bool in_string_{false};
+  bool escape_{false};
+  uint8_t unicode_digits_{0};  // Hex digits still expected after \u
+  uint32_t unicode_{0};
+  uint32_t high_surrogate_{0};
+  bool expect_key_{false};  // Next string in the current object is a key
+  Field field_{FIELD_OTHER};  // What the string being read is captured as
+  Field value_field_{FIELD_OTHER};  // What the next value at item level is
+  bool started_{false};
+  bool done_{false};
+
+  size_t offset_{0};
+  const char *error_{nullptr};
+  uint32_t items_{0};
+  uint32_t skipped_{0};
+  uint32_t truncated_{0};
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
@@ -0,0 +1,116 @@
+/**
+ * Favorites paging window
+ *
+ * With favorites_paging the device holds only part of the favorites list:
+ * up to max_size entries starting at offset. Pages from Home Assistant are
+ * placed by their offset: one that starts at the window's end is appended
+ * and pages are dropped from the front, one that ends at the window's start
+ * is prepended and pages are dropped from the back, and any other page
+ * starts the window over. A page that is already in the window (a late
+ * answer to a retried request) changes nothing.
+ *
+ * The list's length is learned from a page shorter than its request: HA
+ * echoes the limit it was asked for, so a short page is told apart from a
+ * full one whatever the device has asked for since.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "browse_list.h"
+#include "string_arena.h"
+
+namespace esphome {
+namespace radio_controller {
+
+class FavoritesWindow {
+ public:
+  void set_max_size(size_t max_size) { this->max_size_ = max_size; }
+
+  // The whole list at once (load_all_favorites): nothing left to page in
+  void load_all(std::vector<PlaylistItem> &items, StringArena &strings) {
+    this->release_(this->items_.begin(), this->items_.end(), strings);
+    this->items_.swap(items);
+    items.clear();
+    this->offset_ = 0;
+    this->total_ = this->items_.size();
+  }
+
+  // `page` holds the entries from `offset` on, asked for with `limit`; its
+  // strings are taken over or released. False when the window is unchanged
+  bool add_page(uint32_t offset, uint16_t limit, std::vector<PlaylistItem> &page, StringArena &strings) {
+    uint32_t page_end = offset + page.size();
+    if (page.size() < limit) {
+      this->total_ = page_end;
+    } else if (this->total_ >= 0 && page_end >= (uint32_t) this->total_) {
+      this->total_ = -1;  // The list grew
+    }
+
+    uint32_t window_end = this->get_end();
+    if (!this->items_.empty() && !page.empty() && offset >= this->offset_ && page_end <= window_end) {
+      // Already loaded
+      this->release_(page.begin(), page.end(), strings);
+      return false;
+    }
+    if (!this->items_.empty() && offset == window_end) {
+      // Next page: append, drop pages from the front
+      this->items_.insert(this->items_.end(), page.begin(), page.end());
+      this->trim_(true, strings);
+    } else if (!this->items_.empty() && !page.empty() && page_end == this->offset_) {
+      // Previous page: prepend, drop pages from the back
+      this->items_.insert(this->items_.begin(), page.begin(), page.end());
+      this->offset_ = offset;
+      this->trim_(false, strings);
+    } else {
+      // Not next to the window (the first page, or the top of the list again): start over
+      this->release_(this->items_.begin(), this->items_.end(), strings);
+      this->items_.swap(page);
+      page.clear();
+      this->offset_ = offset;
+      this->trim_(false, strings);
+    }
+    return true;
+  }
+
+  // Entries past the window, or the end isn't known yet
+  bool has_more_after() const { return this->total_ < 0 || this->get_end() < (uint32_t) this->total_; }
+
+  const std::vector<PlaylistItem> &get_items() const { return this->items_; }
+  std::vector<PlaylistItem> &get_items() { return this->items_; }
+  size_t get_max_size() const { return this->max_size_; }
+  // Position of the first entry in the full list, and one past the last
+  uint32_t get_offset() const { return this->offset_; }
+  uint32_t get_end() const { return this->offset_ + this->items_.size(); }
+  // Length of the full list, -1 until a short page shows where it ends
+  int32_t get_total() const { return this->total_; }
+
+ protected:
+  void trim_(bool keep_end, StringArena &strings) {
+    if (this->items_.size() <= this->max_size_) {
+      return;
+    }
+    size_t drop = this->items_.size() - this->max_size_;
+    auto first = keep_end ? this->items_.begin() : this->items_.end() - drop;
+    this->release_(first, first + drop, strings);
+    this->items_.erase(first, first + drop);
+    if (keep_end) {
+      this->offset_ += drop;
+    }
+  }
+  void release_(std::vector<PlaylistItem>::iterator first, std::vector<PlaylistItem>::iterator last,
+                StringArena &strings) {
+    for (auto it = first; it != last; ++it) {
+      strings.release(it->name);
+      strings.release(it->uri);
+    }
+  }
+
+  std::vector<PlaylistItem> items_;
+  size_t max_size_{100};
+  uint32_t offset_{0};
+  int32_t total_{-1};
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
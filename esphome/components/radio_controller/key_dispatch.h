@@ -0,0 +1,53 @@
+/**
+ * Key dispatch table
+ *
+ * One byte per key of the 8x10 matrix saying what the key does: the high
+ * nibble is the action, the low nibble its argument (preset slot or mode).
+ * The table is generated from the YAML presets and controls by the
+ * component's codegen (RADIO_CONTROLLER_KEY_MAP in defines.h) and lives in
+ * flash, so routing a key event is one indexed load.
+ *
+ * The action values are shared with __init__.py, which also resolves
+ * overlapping keys: encoder A/B, then memory, mode selector, presets (first
+ * listed wins), encoder button.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace radio_controller {
+
+enum KeyAction : uint8_t {
+  KEY_ACTION_NONE = 0x00,
+  KEY_ACTION_PRESET = 0x10,  // Argument: preset slot (0-6)
+  KEY_ACTION_ENCODER_A = 0x20,
+  KEY_ACTION_ENCODER_B = 0x30,
+  KEY_ACTION_ENCODER_BUTTON = 0x40,
+  KEY_ACTION_MEMORY = 0x50,
+  KEY_ACTION_MODE = 0x60,  // Argument: mode selector position (0-3)
+};
+
+constexpr uint8_t KEY_DISPATCH_ROWS = 8;
+constexpr uint8_t KEY_DISPATCH_COLUMNS = 10;
+constexpr uint8_t KEY_DISPATCH_SIZE = KEY_DISPATCH_ROWS * KEY_DISPATCH_COLUMNS;
+
+constexpr KeyAction key_action_kind(uint8_t entry) { return static_cast<KeyAction>(entry & 0xF0); }
+constexpr uint8_t key_action_arg(uint8_t entry) { return entry & 0x0F; }
+
+class KeyDispatch {
+ public:
+  constexpr explicit KeyDispatch(const uint8_t (&table)[KEY_DISPATCH_SIZE]) : table_(table) {}
+
+  // Entry for a key; GPIO events and anything outside the matrix are KEY_ACTION_NONE
+  constexpr uint8_t lookup(uint8_t row, uint8_t column) const {
+    return (row < KEY_DISPATCH_ROWS && column < KEY_DISPATCH_COLUMNS) ? this->table_[row * KEY_DISPATCH_COLUMNS + column]
+                                                                       : static_cast<uint8_t>(KEY_ACTION_NONE);
+  }
+
+ protected:
+  const uint8_t (&table_)[KEY_DISPATCH_SIZE];
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
@@ -0,0 +1,99 @@
+/**
+ * First-letter jump index
+ *
+ * Records where each run of names with the same initial ('#' for digits,
+ * then A-Z) starts, so browsing can jump letter by letter without scanning.
+ * It is one small table of positions, rebuilt whenever the favorites
+ * change; the names themselves stay where they are.
+ *
+ * The favorites are radios by name followed by playlists by name, so the
+ * same letter can start twice. Each start is kept in list order, so jumps
+ * go through the radios' letters and then on into the playlists'.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace radio_controller {
+
+// '#' (digits, and names without a letter or digit) then A-Z
+constexpr uint8_t LETTER_GROUPS = 27;
+constexpr uint16_t LETTER_NONE = UINT16_MAX;
+
+// First letter or digit of the name, upper case; digits group under '#'
+inline char name_initial(const char *name) {
+  for (; *name != '\0'; name++) {
+    char c = *name;
+    if (c >= 'a' && c <= 'z') {
+      return c - 'a' + 'A';
+    }
+    if (c >= 'A' && c <= 'Z') {
+      return c;
+    }
+    if (c >= '0' && c <= '9') {
+      return '#';
+    }
+  }
+  return ' ';
+}
+
+inline uint8_t letter_group(char initial) { return initial >= 'A' && initial <= 'Z' ? initial - 'A' + 1 : 0; }
+inline char letter_group_initial(uint8_t group) { return group == 0 ? '#' : 'A' + group - 1; }
+
+class LetterIndex {
+ public:
+  void clear() {
+    this->starts_.clear();
+    this->groups_ = 0;
+  }
+
+  // name_at(i) gives the i-th name; positions past LETTER_NONE aren't indexed
+  template<typename NameAt> void build(size_t count, NameAt name_at) {
+    this->clear();
+    uint8_t previous = LETTER_GROUPS;
+    for (size_t i = 0; i < count && i < LETTER_NONE; i++) {
+      uint8_t group = letter_group(name_initial(name_at(i)));
+      if (group != previous) {
+        this->starts_.push_back(i);
+        this->groups_ |= 1u << group;
+        previous = group;
+      }
+    }
+  }
+
+  // Start of the next letter after `position`, or LETTER_NONE after the last
+  uint16_t next(size_t position) const {
+    auto it = std::upper_bound(this->starts_.begin(), this->starts_.end(), position);
+    return it == this->starts_.end() ? LETTER_NONE : *it;
+  }
+
+  // Start of the letter holding `position`, or of the one before when it is
+  // already there; LETTER_NONE before the first
+  uint16_t previous(size_t position) const {
+    auto it = std::upper_bound(this->starts_.begin(), this->starts_.end(), position);
+    if (it == this->starts_.begin()) {
+      return LETTER_NONE;
+    }
+    --it;
+    if (*it < position) {
+      return *it;
+    }
+    return it == this->starts_.begin() ? LETTER_NONE : *(it - 1);
+  }
+
+  // Groups with at least one name, and letter starts (more than the groups
+  // when a letter starts again in the playlists)
+  uint8_t get_groups() const { return __builtin_popcount(this->groups_); }
+  size_t get_starts() const { return this->starts_.size(); }
+
+ protected:
+  std::vector<uint16_t> starts_;
+  uint32_t groups_{0};  // Bit per group
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
@@ -0,0 +1,106 @@
+/**
+ * Table-driven quadrature decoder
+ *
+ * Turns A/B channel levels into detents. The state is the 2-bit Gray code
+ * (A << 1) | B; a 16-entry table indexed by (old << 2) | new gives the step
+ * for every transition: +1 clockwise (00 -> 01 -> 11 -> 10 -> 00), -1
+ * counter-clockwise, 0 for no change, or illegal when both channels changed
+ * at once (a missed edge). Illegal transitions are counted and drop the
+ * partial detent.
+ *
+ * Steps per detent depend on the encoder: the panel encoder rests every
+ * second state (2), the legacy firmware's every fourth (4).
+ *
+ * Header-only with no ESPHome dependencies, so the legacy firmware's
+ * Input::EncoderControl uses it too.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace radio_controller {
+
+// Table entry for a transition where both channels changed
+constexpr int8_t QUADRATURE_ILLEGAL = 2;
+
+// Step per transition, indexed by (old_state << 2) | new_state
+constexpr int8_t QUADRATURE_TRANSITIONS[16] = {
+    0,  1,  -1, QUADRATURE_ILLEGAL,  // from 00
+    -1, 0,  QUADRATURE_ILLEGAL, 1,   // from 01
+    1,  QUADRATURE_ILLEGAL, 0,  -1,  // from 10
+    QUADRATURE_ILLEGAL, -1, 1,  0,   // from 11
+};
+
+class QuadratureDecoder {
+ public:
+  explicit QuadratureDecoder(uint8_t steps_per_detent = 4) : steps_per_detent_(steps_per_detent) {}
+
+  void set_steps_per_detent(uint8_t steps) {
+    this->steps_per_detent_ = steps;
+    this->progress_ = 0;
+  }
+
+  // New channel levels, optionally with the time they were read. Returns
+  // the detent completed by this transition: +1 clockwise, -1, or 0
+  int8_t update(bool a, bool b, uint32_t timestamp_us = 0) {
+    uint8_t state = (a ? 0b10 : 0) | (b ? 0b01 : 0);
+    int8_t step = QUADRATURE_TRANSITIONS[(this->state_ << 2) | state];
+    this->state_ = state;
+    if (step == 0) {
+      return 0;
+    }
+    if (step == QUADRATURE_ILLEGAL) {
+      this->errors_++;
+      this->progress_ = 0;
+      return 0;
+    }
+
+    this->step_interval_us_ = timestamp_us - this->step_us_;
+    this->step_us_ = timestamp_us;
+    this->progress_ += step;
+    if (this->progress_ >= this->steps_per_detent_) {
+      this->progress_ = 0;
+      this->position_++;
+      return 1;
+    }
+    if (this->progress_ <= -this->steps_per_detent_) {
+      this->progress_ = 0;
+      this->position_--;
+      return -1;
+    }
+    return 0;
+  }
+
+  // One channel changed (the keypad reports A and B as separate keys)
+  int8_t update_channel(bool is_a, bool level, uint32_t timestamp_us = 0) {
+    bool a = is_a ? level : (this->state_ & 0b10) != 0;
+    bool b = is_a ? (this->state_ & 0b01) != 0 : level;
+    return this->update(a, b, timestamp_us);
+  }
+
+  // Current Gray code state, (A << 1) | B
+  uint8_t get_state() const { return this->state_; }
+  // Net detents since construction
+  int32_t get_position() const { return this->position_; }
+  // Steps into the current detent (negative counter-clockwise)
+  int8_t get_progress() const { return this->progress_; }
+  uint8_t get_steps_per_detent() const { return this->steps_per_detent_; }
+  // Transitions where both channels changed
+  uint32_t get_error_count() const { return this->errors_; }
+  // Timestamp of the last valid step, and the time since the one before it
+  uint32_t get_step_us() const { return this->step_us_; }
+  uint32_t get_step_interval_us() const { return this->step_interval_us_; }
+
+ protected:
+  uint8_t steps_per_detent_;
+  uint8_t state_{0};
+  int8_t progress_{0};
+  int32_t position_{0};
+  uint32_t errors_{0};
+  uint32_t step_us_{0};
+  uint32_t step_interval_us_{0};
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
@@ -1,15 +1,27 @@
 #include "radio_controller.h"
 #include "esphome/core/log.h"
+#include "esphome/core/defines.h"
 #include "esphome/core/application.h"
 #include "esphome/components/retrotext_display/is31fl3737_driver.h"
-#include <ArduinoJson.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace esphome {
 namespace radio_controller {
 
 static const char *const TAG = "radio_controller";
 
+// A page request without an answer for this long may be sent again
+static const uint32_t FAVORITES_PAGE_TIMEOUT_MS = 5000;
+
+#ifndef RADIO_CONTROLLER_KEY_MAP
+#error "RADIO_CONTROLLER_KEY_MAP is generated from the presets and controls by the radio_controller codegen"
+#endif
+// Key -> action for the configured presets and controls (see key_dispatch.h)
+static constexpr uint8_t KEY_MAP[KEY_DISPATCH_SIZE] = RADIO_CONTROLLER_KEY_MAP;
+static constexpr KeyDispatch KEY_DISPATCH(KEY_MAP);
+
 void RadioController::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Radio Controller...");
   
@@ -44,14 +56,8 @@ void RadioController::setup() {
   // Note: Preset slot sensors removed - caused API connection issues
   // Preset data is accessible via select component and current_preset sensor
   
-  // Register callbacks with keypad
-  this->keypad_->add_on_key_press_callback([this](uint8_t row, uint8_t col, uint8_t key) {
-    this->handle_key_press_(row, col);
-  });
-  
-  this->keypad_->add_on_key_release_callback([this](uint8_t row, uint8_t col, uint8_t key) {
-    this->handle_key_release_(row, col);
-  });
+  // Key events arrive stamped with their read time; handled from loop()
+  this->keypad_->add_event_queue(&this->key_events_);
   
   // Build initial browse list from stored presets
   build_browse_list_();
@@ -63,8 +69,12 @@ void RadioController::setup() {
 }
 
 void RadioController::loop() {
+  this->process_key_events_();
+  this->update_browse_spin_();
+  
   // Update VU meter backlight slew
   this->update_vu_meter_slew_();
+  this->update_memory_led_pulse_();
   
   // Check for browse mode timeout (5 seconds of inactivity)
   if (this->browse_mode_active_ && this->last_browse_interaction_ > 0) {
@@ -92,7 +102,7 @@ void RadioController::loop() {
               this->now_playing_metadata_ != "Stopped") {
             display_text = this->format_display_text_(this->now_playing_metadata_);
           } else {
-            display_text = this->format_display_text_(this->browse_items_[this->currently_playing_index_].name);
+            display_text = this->format_display_text_(this->text_(this->browse_items_[this->currently_playing_index_].name));
           }
           
           if (this->display_) {
@@ -103,6 +113,11 @@ void RadioController::loop() {
       }
     }
   }
+  
+  // LED helpers only request a push; send everything changed since the last pass at once
+  if (this->panel_leds_initialized_ && this->led_driver_) {
+    this->flush_panel_leds_();
+  }
 }
 
 void RadioController::dump_config() {
@@ -124,6 +139,45 @@ void RadioController::dump_config() {
   if (this->has_encoder_button_) {
     ESP_LOGCONFIG(TAG, "  Encoder Button: Row=%d, Col=%d", this->encoder_row_, this->encoder_column_);
   }
+  if (this->encoder_acceleration_.is_enabled()) {
+    ESP_LOGCONFIG(TAG, "  Encoder Acceleration: settle %u ms, redraw every %u ms while spinning",
+                  (unsigned) this->spin_settle_ms_, (unsigned) this->spin_redraw_interval_ms_);
+    for (const auto &point : this->encoder_acceleration_.get_points()) {
+      if (point.step == ENCODER_STEP_GROUP) {
+        ESP_LOGCONFIG(TAG, "    Detents < %u ms apart: next alphabetical group", (unsigned) (point.below_us / 1000));
+      } else {
+        ESP_LOGCONFIG(TAG, "    Detents < %u ms apart: %u items", (unsigned) (point.below_us / 1000),
+                      (unsigned) point.step);
+      }
+    }
+    ESP_LOGCONFIG(TAG, "    %u group jumps, %u browse redraws skipped", (unsigned) this->encoder_group_jumps_,
+                  (unsigned) this->browse_redraws_skipped_);
+  }
+  ESP_LOGCONFIG(TAG, "  Letter Jumps: %u (favorites under %u letters)", (unsigned) this->encoder_letter_jumps_,
+                this->favorites_letters_.get_groups());
+  if (!this->favorites_page_event_.empty()) {
+    ESP_LOGCONFIG(TAG, "  Favorites Paging: %u per page, window %u, prefetch %u items from an edge",
+                  this->favorites_page_size_, (unsigned) this->favorites_.get_max_size(), this->favorites_prefetch_);
+    ESP_LOGCONFIG(TAG, "    Event: %s", this->favorites_page_event_.c_str());
+    ESP_LOGCONFIG(TAG, "    Window %u-%u of %d, %u pages loaded", (unsigned) this->favorites_.get_offset(),
+                  (unsigned) this->favorites_.get_end(), (int) this->favorites_.get_total(),
+                  (unsigned) this->favorites_pages_loaded_);
+  }
+  this->dump_browse_memory_();
+  ESP_LOGCONFIG(TAG, "  Key events: %u handled, %u dropped, queue peak %u, latency max %u us",
+                (unsigned) this->key_events_handled_, (unsigned) this->key_events_.get_dropped(),
+                this->key_events_.get_high_water(), (unsigned) this->key_latency_max_us_);
+  if (this->panel_leds_initialized_ && this->led_driver_) {
+    const auto &stats = this->led_driver_->get_stats();
+    ESP_LOGCONFIG(TAG, "  Panel LEDs I2C: %u frames (%u unchanged), %u bytes in %u writes, saved %d bytes / %d writes",
+                  (unsigned) stats.frames, (unsigned) stats.frames_unchanged, (unsigned) stats.bytes_written,
+                  (unsigned) stats.transactions, (int) stats.bytes_saved(), (int) stats.transactions_saved());
+    ESP_LOGCONFIG(TAG, "  Panel LEDs bus: %u writes, %u page selects (%u skipped)",
+                  (unsigned) stats.bus_writes, (unsigned) stats.page_selects, (unsigned) stats.page_selects_skipped);
+    ESP_LOGCONFIG(TAG, "  Panel LED updates: %u requests in %u flushes (%u pushes avoided)",
+                  (unsigned) stats.show_requests, (unsigned) stats.flushes, (unsigned) stats.flushes_avoided());
+    ESP_LOGCONFIG(TAG, "  Panel LED fades: %s", this->hardware_fades_ ? "hardware (auto breath)" : "software");
+  }
 }
 
 void RadioController::add_preset(uint8_t row, uint8_t column, const std::string &display_text, 
@@ -158,104 +212,112 @@ void RadioController::set_encoder_button(uint8_t row, uint8_t column) {
   ESP_LOGD(TAG, "Set encoder button: Row=%d, Col=%d", row, column);
 }
 
+void RadioController::process_key_events_() {
+  tca8418_keypad::TimedKeyEvent event;
+  while (this->key_events_.pop(&event)) {
+    this->key_event_us_ = event.timestamp_us;
+    uint32_t latency = micros() - event.timestamp_us;
+    if (latency > this->key_latency_max_us_) {
+      this->key_latency_max_us_ = latency;
+    }
+    this->key_events_handled_++;
+    if (event.press) {
+      this->handle_key_press_(event.row, event.col);
+    } else {
+      this->handle_key_release_(event.row, event.col);
+    }
+  }
+}
+
 void RadioController::handle_key_press_(uint8_t row, uint8_t column) {
   ESP_LOGI(TAG, "Key pressed: row=%d, col=%d", row, column);
   
-  // Check if this is an encoder rotation channel (A or B)
-  // Actual hardware mapping (may differ from HardwareConfig.h)
-  if (this->has_encoder_button_ && row == this->encoder_row_) {
-    // Encoder channel A (col 2) or B (col 3)
-    if (column == 3) {  // Encoder B
-      this->encoder_b_state_ = true;
-      this->process_encoder_rotation_();
+  uint8_t entry = KEY_DISPATCH.lookup(row, column);
+  switch (key_action_kind(entry)) {
+    // Encoder rotation channels (col 2 = A, col 3 = B on the encoder row)
+    case KEY_ACTION_ENCODER_A:
+      this->process_encoder_rotation_(true, true);
       return;
-    } else if (column == 2) {  // Encoder A
-      this->encoder_a_state_ = true;
-      this->process_encoder_rotation_();
+    case KEY_ACTION_ENCODER_B:
+      this->process_encoder_rotation_(false, true);
       return;
-    }
-  }
-  
-  // Check if this is the memory button (if configured)
-  if (this->has_memory_button_ && row == this->memory_button_row_ && column == this->memory_button_col_) {
-    // Record press time for long-press detection
-    this->memory_button_press_time_ = millis();
-    return;
-  }
-  
-  // Check if this is a mode selector button
-  if (row == 0 && column >= 5 && column <= 8) {
-    uint8_t mode = column - 5;  // 0-3 for M0-M3
-    const char* mode_names[] = {"Stereo", "Stereo-Far", "Q", "Mono"};
-    ESP_LOGI(TAG, "Mode selector: M%d (%s)", mode, mode_names[mode]);
     
-    // Update mode LED
-    this->update_mode_selector_led_(mode);
+    case KEY_ACTION_MEMORY:
+      // Record press time for long-press detection (when read, not when handled)
+      this->memory_button_press_time_ = millis() - (micros() - this->key_event_us_) / 1000;
+      return;
     
-    // Publish mode change for automations
-    if (this->mode_text_sensor_ != nullptr) {
-      this->mode_text_sensor_->publish_state(mode_names[mode]);
-    }
-    return;
-  }
-  
-  // Check if this is a preset button
-  Preset *preset = this->find_preset_(row, column);
-  if (preset != nullptr) {
-    // If in save preset mode, save currently playing station to this preset slot
-    if (this->save_preset_mode_) {
-      ESP_LOGI(TAG, "SAVE MODE: Preset button pressed at row=%d, col=%d", row, column);
+    case KEY_ACTION_MODE: {
+      uint8_t mode = key_action_arg(entry);  // 0-3 for M0-M3
+      const char* mode_names[] = {"Stereo", "Stereo-Far", "Q", "Mono"};
+      ESP_LOGI(TAG, "Mode selector: M%d (%s)", mode, mode_names[mode]);
       
-      // Find preset slot index
-      for (size_t i = 0; i < this->presets_.size(); i++) {
-        if (this->presets_[i].row == row && this->presets_[i].column == column) {
-          // Get currently playing item from browse list (works for presets, playlists, and favorites)
-          if (currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
-            const auto &playing_item = browse_items_[currently_playing_index_];
-            
-            // Use the item's name and target (preserves playlist URI, not track metadata)
-            ESP_LOGI(TAG, "SAVE MODE: Saving '%s' (target: %s) to slot %d", 
-                     playing_item.name.c_str(), playing_item.target.c_str(), i + 1);
-            
-            // Save to the selected slot
-            this->save_preset_to_slot(i, playing_item.target, playing_item.name);
-            
-            // DON'T activate the preset - stay on current station
-            // Just update the browse list and LED to reflect the save
-            this->build_browse_list_();
-            this->update_leds_for_browse_();
-            
-            // After brief confirmation, restore playing display
-            // (save_preset_to_slot already shows "PRESET X: SAVED")
-            // The display will automatically update on next metadata update
-            
-            ESP_LOGI(TAG, "SAVE MODE: Complete - staying on current station");
-          } else {
-            ESP_LOGW(TAG, "SAVE MODE: Error - no valid currently playing item");
-            if (this->display_) {
-              this->display_->set_text("SAVE FAILED");
-            }
+      // Update mode LED
+      this->update_mode_selector_led_(mode);
+      
+      // Publish mode change for automations
+      if (this->mode_text_sensor_ != nullptr) {
+        this->mode_text_sensor_->publish_state(mode_names[mode]);
+      }
+      return;
+    }
+    
+    case KEY_ACTION_PRESET: {
+      size_t slot = key_action_arg(entry);
+      if (slot >= this->presets_.size()) {
+        break;
+      }
+      // If in save preset mode, save currently playing station to this preset slot
+      if (this->save_preset_mode_) {
+        ESP_LOGI(TAG, "SAVE MODE: Preset button pressed at row=%d, col=%d", row, column);
+        
+        // Get currently playing item from browse list (works for presets, playlists, and favorites)
+        if (currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
+          const auto &playing_item = browse_items_[currently_playing_index_];
+          
+          // Use the item's name and target (preserves playlist URI, not track metadata)
+          ESP_LOGI(TAG, "SAVE MODE: Saving '%s' (target: %s) to slot %d", 
+                   this->text_(playing_item.name), this->text_(playing_item.target), slot + 1);
+          
+          // Save to the selected slot (patches it in the browse list)
+          // Copies: the slot's new strings are added to the string arena
+          std::string target = this->strings_.str(playing_item.target);
+          std::string name = this->strings_.str(playing_item.name);
+          this->save_preset_to_slot(slot, target, name);
+          
+          // DON'T activate the preset - stay on current station
+          // Just update the LED to reflect the save
+          this->update_leds_for_browse_();
+          
+          // After brief confirmation, restore playing display
+          // (save_preset_to_slot already shows "PRESET X: SAVED")
+          // The display will automatically update on next metadata update
+          
+          ESP_LOGI(TAG, "SAVE MODE: Complete - staying on current station");
+        } else {
+          ESP_LOGW(TAG, "SAVE MODE: Error - no valid currently playing item");
+          if (this->display_) {
+            this->display_->set_text("SAVE FAILED");
           }
-          this->save_preset_mode_ = false;
-          return;
         }
+        this->save_preset_mode_ = false;
+        return;
       }
-      // If not a valid preset slot, cancel save mode
-      ESP_LOGI(TAG, "SAVE MODE: Cancelled - button not a preset slot");
-      this->save_preset_mode_ = false;
+      
+      // Regular preset button - play that preset
+      this->activate_preset_(&this->presets_[slot]);
       return;
     }
     
-    // Regular preset button - play that preset
-    this->activate_preset_(preset);
-    return;
-  }
-  
-  // Check if this is the encoder button - NEW: play/stop toggle
-  if (this->has_encoder_button_ && row == this->encoder_row_ && column == this->encoder_column_) {
-    ESP_LOGI(TAG, "Encoder button pressed: toggle play/stop");
-    this->toggle_play_stop_();
-    return;
+    case KEY_ACTION_ENCODER_BUTTON:
+      // Play/stop on release, unless the knob turned while held (letter jumps)
+      ESP_LOGD(TAG, "Encoder button pressed");
+      this->encoder_button_held_ = true;
+      this->encoder_button_turned_ = false;
+      return;
+    
+    default:
+      break;
   }
   
   // Unknown button
@@ -263,22 +325,34 @@ void RadioController::handle_key_press_(uint8_t row, uint8_t column) {
 }
 
 void RadioController::handle_key_release_(uint8_t row, uint8_t column) {
-  // Handle encoder channel releases - update state and process
+  uint8_t entry = KEY_DISPATCH.lookup(row, column);
+  
+  // Handle encoder channel releases
   // The quadrature decoder tracks detent progress and prevents double-counting
-  if (this->has_encoder_button_ && row == this->encoder_row_) {
-    if (column == 3) {  // Encoder B
-      this->encoder_b_state_ = false;
-      this->process_encoder_rotation_();
-      return;
-    } else if (column == 2) {  // Encoder A
-      this->encoder_a_state_ = false;
-      this->process_encoder_rotation_();
-      return;
+  if (entry == KEY_ACTION_ENCODER_A || entry == KEY_ACTION_ENCODER_B) {
+    this->process_encoder_rotation_(entry == KEY_ACTION_ENCODER_A, false);
+    return;
+  }
+  
+  if (entry == KEY_ACTION_ENCODER_BUTTON) {
+    bool turned = this->encoder_button_turned_;
+    this->encoder_button_held_ = false;
+    this->encoder_button_turned_ = false;
+    this->letter_jump_pending_ = 0;
+    if (turned) {
+      // Letter jumps done: show the item landed on
+      if (this->browse_mode_active_) {
+        this->show_browse_item_();
+      }
+    } else {
+      ESP_LOGI(TAG, "Encoder button released: toggle play/stop");
+      this->toggle_play_stop_();
     }
+    return;
   }
   
   // Check if this is memory button release - toggle save preset mode
-  if (this->has_memory_button_ && row == this->memory_button_row_ && column == this->memory_button_col_) {
+  if (entry == KEY_ACTION_MEMORY) {
     // Toggle save preset mode
     if (this->save_preset_mode_) {
       // Already in save mode - tap again exits without saving
@@ -292,7 +366,7 @@ void RadioController::handle_key_release_(uint8_t row, uint8_t column) {
         // Restore now-playing display
         if (currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
           if (this->display_ != nullptr) {
-            std::string display_text = this->format_display_text_(browse_items_[currently_playing_index_].name);
+            std::string display_text = this->format_display_text_(this->text_(browse_items_[currently_playing_index_].name));
             this->display_->set_text(display_text.c_str());
           }
         }
@@ -310,7 +384,7 @@ void RadioController::handle_key_release_(uint8_t row, uint8_t column) {
       } else {
         const auto &item = browse_items_[currently_playing_index_];
         ESP_LOGI(TAG, "SAVE MODE: Entered - will save '%s' (target: %s)", 
-                 item.name.c_str(), item.target.c_str());
+                 this->text_(item.name), this->text_(item.target));
         this->save_preset_mode_ = true;
         if (this->display_) {
           this->display_->set_text("SELECT PRESET (TAP MEMORY TO CANCEL)");
@@ -323,99 +397,52 @@ void RadioController::handle_key_release_(uint8_t row, uint8_t column) {
   ESP_LOGV(TAG, "Key released: row=%d, col=%d", row, column);
 }
 
-void RadioController::process_encoder_rotation_() {
-  // Full quadrature decoding with Gray code state machine
-  // Tracks 4-step detent cycle for reliable rotation detection
-  
-  uint8_t current_state = (this->encoder_a_state_ ? 0b10 : 0) | (this->encoder_b_state_ ? 0b01 : 0);
-  uint8_t old_state = this->encoder_last_encoded_;
-  
-  // Only process if state actually changed
-  if (current_state == old_state) {
+void RadioController::process_encoder_rotation_(bool is_a, bool level) {
+  // Table-driven quadrature decoding, 2 steps per detent for this encoder hardware.
+  // Edge timing comes from the keypad's read timestamps, not from when we got here
+  uint32_t errors = this->encoder_decoder_.get_error_count();
+  int8_t detent = this->encoder_decoder_.update_channel(is_a, level, this->key_event_us_);
+  if (this->encoder_decoder_.get_error_count() != errors) {
+    ESP_LOGV(TAG, "Encoder: Invalid transition to %d, resetting (%u so far)", this->encoder_decoder_.get_state(),
+             (unsigned) this->encoder_decoder_.get_error_count());
     return;
   }
-  
-  // Update state for next comparison
-  this->encoder_last_encoded_ = current_state;
-  
-  // Detect valid Gray code transitions
-  bool valid_transition = false;
-  int8_t direction = 0;
-  
-  // Clockwise: 00 -> 01 -> 11 -> 10 -> 00
-  if ((old_state == 0b00 && current_state == 0b01) ||
-      (old_state == 0b01 && current_state == 0b11) ||
-      (old_state == 0b11 && current_state == 0b10) ||
-      (old_state == 0b10 && current_state == 0b00)) {
-    direction = 1;
-    valid_transition = true;
-  }
-  // Counter-clockwise: 00 -> 10 -> 11 -> 01 -> 00
-  else if ((old_state == 0b00 && current_state == 0b10) ||
-           (old_state == 0b10 && current_state == 0b11) ||
-           (old_state == 0b11 && current_state == 0b01) ||
-           (old_state == 0b01 && current_state == 0b00)) {
-    direction = -1;
-    valid_transition = true;
-  }
-  
-  if (!valid_transition) {
-    ESP_LOGV(TAG, "Encoder: Invalid transition %d->%d, resetting", old_state, current_state);
-    this->encoder_detent_count_ = 0;
+  ESP_LOGV(TAG, "Encoder: state %d, detent: %d/2, %u us since last edge", this->encoder_decoder_.get_state(),
+           abs(this->encoder_decoder_.get_progress()), (unsigned) this->encoder_decoder_.get_step_interval_us());
+  if (detent == 0) {
     return;
   }
+  ESP_LOGD(TAG, "Encoder: %s detent complete (count:%d)", detent > 0 ? "CW" : "CCW",
+           (int) this->encoder_decoder_.get_position());
   
-  // Track detent progress (2 steps per detent for this encoder hardware)
-  this->encoder_detent_count_ += direction;
-  
-  ESP_LOGV(TAG, "Encoder: %s transition %d->%d, detent: %d/2",
-           direction > 0 ? "CW" : "CCW", old_state, current_state, 
-           abs(this->encoder_detent_count_));
-  
-  // Complete detent reached (2 steps, not 4)
-  bool detent_complete = false;
-  if (this->encoder_detent_count_ >= 2) {
-    this->encoder_count_++;
-    this->encoder_detent_count_ = 0;
-    detent_complete = true;
-    ESP_LOGD(TAG, "Encoder: CW detent complete (count:%d)", this->encoder_count_);
-  } else if (this->encoder_detent_count_ <= -2) {
-    this->encoder_count_--;
-    this->encoder_detent_count_ = 0;
-    detent_complete = true;
-    ESP_LOGD(TAG, "Encoder: CCW detent complete (count:%d)", this->encoder_count_);
-  }
-  
-  // NEW: Handle encoder turns - always scrolls unified browse list
+  // Handle encoder turns - always scrolls unified browse list
   // Direction inverted: CW = previous, CCW = next (per user request)
-  if (detent_complete) {
-    int32_t encoder_change = this->encoder_count_ - this->last_encoder_count_;
-    
-    if (encoder_change > 0) {
-      ESP_LOGI(TAG, "Encoder: CW scroll (previous)");
-      this->scroll_browse_(-1);  // CW = backward
-      this->last_encoder_count_ = this->encoder_count_;
-    } else if (encoder_change < 0) {
-      ESP_LOGI(TAG, "Encoder: CCW scroll (next)");
-      this->scroll_browse_(1);   // CCW = forward
-      this->last_encoder_count_ = this->encoder_count_;
-    }
+  int browse_direction = detent > 0 ? -1 : 1;  // CW = backward, CCW = forward
+  
+  if (this->encoder_button_held_) {
+    this->encoder_button_turned_ = true;
+    this->jump_browse_letter_(browse_direction);
+    return;
   }
   
-  // Reset count periodically to prevent overflow
-  if (abs(this->encoder_count_) > 1000) {
-    this->encoder_count_ = 0;
-    this->last_encoder_count_ = 0;
+  // Faster spins move further per detent
+  uint16_t step = this->encoder_acceleration_.on_detent(this->key_event_us_, browse_direction);
+  this->last_detent_ms_ = millis();
+  ESP_LOGI(TAG, "Encoder: %s scroll (%s), step %d, detent interval %u us", detent > 0 ? "CW" : "CCW",
+           detent > 0 ? "previous" : "next", step, (unsigned) this->encoder_acceleration_.get_interval_us());
+  if (step == ENCODER_STEP_GROUP) {
+    this->jump_browse_group_(browse_direction);
+  } else {
+    this->scroll_browse_(browse_direction * step);
   }
 }
 
 Preset* RadioController::find_preset_(uint8_t row, uint8_t column) {
-  for (auto &preset : this->presets_) {
-    if (preset.row == row && preset.column == column) {
-      return &preset;
-    }
+  uint8_t entry = KEY_DISPATCH.lookup(row, column);
+  if (key_action_kind(entry) != KEY_ACTION_PRESET || key_action_arg(entry) >= this->presets_.size()) {
+    return nullptr;
   }
-  return nullptr;
+  return &this->presets_[key_action_arg(entry)];
 }
 
 Preset* RadioController::find_preset_by_name_(const std::string &name) {
@@ -540,11 +567,11 @@ void RadioController::sync_preset_led_from_name(const std::string &preset_name)
   for (size_t i = 0; i < browse_items_.size(); i++) {
     const auto &item = browse_items_[i];
     // Check if name contains the preset name (partial match for flexibility)
-    if (item.name.find(preset_name) != std::string::npos || 
-        preset_name.find(item.name) != std::string::npos) {
+    const char *name = this->text_(item.name);
+    if (strstr(name, preset_name.c_str()) != nullptr || strstr(preset_name.c_str(), name) != nullptr) {
       if (item.type == BrowseItem::PRESET && item.preset_index >= 0 && item.preset_index < 7) {
         ESP_LOGI(TAG, "Syncing preset LED by name: '%s' matched browse item '%s' (preset %d)", 
-                 preset_name.c_str(), item.name.c_str(), item.preset_index);
+                 preset_name.c_str(), this->text_(item.name), item.preset_index);
         this->current_preset_index_ = item.preset_index;
         this->currently_playing_index_ = i;
         this->is_playing_ = true;
@@ -635,7 +662,44 @@ void RadioController::call_home_assistant_service_(const std::string &service,
 #endif
 }
 
+void RadioController::fire_home_assistant_event_(const std::string &event,
+                                                  const std::map<std::string, std::string> &data) {
+#ifdef USE_API
+  api::HomeassistantServiceResponse call;
+  call.service = event;
+  call.is_event = true;
+  for (const auto &kv : data) {
+    api::HomeassistantServiceMap entry;
+    entry.key = kv.first;
+    entry.value = kv.second;
+    call.data.push_back(entry);
+  }
+  api::global_api_server->send_homeassistant_service_call(call);
+#else
+  ESP_LOGW(TAG, "API not available, cannot fire event: %s", event.c_str());
+#endif
+}
+
 // Panel LED Management
+
+// VU meter backlights: row 2, "Tuning Backlight" at CS=9, "Signal Backlight" at CS=10
+static constexpr uint8_t VU_METER_ROW = 2;
+static constexpr uint8_t TUNING_BACKLIGHT_CS = 9;
+static constexpr uint8_t SIGNAL_BACKLIGHT_CS = 10;
+
+// Memory button LED (SW3/CS5)
+static constexpr uint8_t MEMORY_LED_SW = 3;
+static constexpr uint8_t MEMORY_LED_CS = 5;
+
+// Auto breath engines: ABM-1 backlight fade, ABM-2 memory LED pulse.
+// The VU meter test borrows all three.
+static constexpr uint8_t ABM_BACKLIGHT = 1;
+static constexpr uint8_t ABM_MEMORY_LED = 2;
+
+// Backlight fade from off; the software slew takes ~650 ms for 0 → 26,
+// the nearest chip ramp is 840 ms
+static constexpr uint32_t VU_METER_FADE_IN_MS = 840;
+
 bool RadioController::init_panel_leds_() {
   // LED positions from HardwareConfig.h
   constexpr uint8_t LED_I2C_ADDRESS = 0x55;
@@ -658,6 +722,21 @@ bool RadioController::init_panel_leds_() {
   return true;
 }
 
+void RadioController::flush_panel_leds_() {
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    // Sent in chunks between keypad reads. While a push is queued, later
+    // changes wait for the next pass.
+    if (!this->led_driver_->is_show_pending() && this->led_driver_->start_flush()) {
+      esphome::retrotext_display::IS31FL3737Driver *driver = this->led_driver_.get();
+      this->arbiter_->submit_bulk([driver]() { return driver->show_step(); });
+    }
+    return;
+  }
+#endif
+  this->led_driver_->flush();
+}
+
 void RadioController::update_preset_led_(uint8_t preset_index) {
   if (!this->panel_leds_initialized_ || !this->led_driver_) {
     return;
@@ -686,7 +765,7 @@ void RadioController::update_preset_led_(uint8_t preset_index) {
   
   // Turn on the active preset LED
   this->led_driver_->set_pixel(PRESET_LEDS[preset_index].cs, PRESET_LEDS[preset_index].sw, 255);
-  this->led_driver_->show();
+  this->led_driver_->request_show();
   
   ESP_LOGD(TAG, "Updated preset LED: %d", preset_index);
 }
@@ -703,7 +782,7 @@ void RadioController::update_mode_led_(bool playing) {
   
   uint8_t brightness = playing ? 255 : 0;
   this->led_driver_->set_pixel(STEREO_LED_CS, STEREO_LED_SW, brightness);
-  this->led_driver_->show();
+  this->led_driver_->request_show();
   
   ESP_LOGD(TAG, "Updated mode LED: Stereo %s", playing ? "ON" : "OFF");
 }
@@ -723,7 +802,7 @@ void RadioController::update_mode_selector_led_(uint8_t mode) {
     this->led_driver_->set_pixel(5 + mode, 0, 255);
   }
   
-  this->led_driver_->show();
+  this->led_driver_->request_show();
   
   ESP_LOGD(TAG, "Updated mode selector LED: M%d", mode);
 }
@@ -731,6 +810,86 @@ void RadioController::update_mode_selector_led_(uint8_t mode) {
 void RadioController::set_vu_meter_target_brightness(uint8_t target) {
   this->vu_meter_target_brightness_ = target;
   ESP_LOGD(TAG, "VU meter target brightness set to: %d", target);
+  
+  // A new target takes over from a running fade at the level it was heading for
+  this->finish_vu_meter_fade_();
+  
+  // The chip can only ramp between off and the PWM value, so it handles
+  // fades up from off; level changes go through the software slew
+  if (this->vu_meter_current_brightness_ == 0 && target > 0 && !this->vu_meter_test_active_) {
+    this->start_vu_meter_fade_in_(target);
+  }
+}
+
+bool RadioController::start_vu_meter_fade_in_(uint8_t target) {
+  if (!this->hardware_fades_ || !this->panel_leds_initialized_ || !this->led_driver_) {
+    return false;
+  }
+  
+  // Peak level first, then the LEDs follow ABM-1 up to it from zero
+  this->led_driver_->set_pixel(TUNING_BACKLIGHT_CS, VU_METER_ROW, target);
+  this->led_driver_->set_pixel(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, target);
+  auto breath = esphome::retrotext_display::IS31FL3737Breath::fade_in(VU_METER_FADE_IN_MS);
+  if (!this->led_driver_->set_breath(ABM_BACKLIGHT, breath) ||
+      !this->led_driver_->set_led_mode(TUNING_BACKLIGHT_CS, VU_METER_ROW, ABM_BACKLIGHT) ||
+      !this->led_driver_->set_led_mode(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, ABM_BACKLIGHT) ||
+      !this->led_driver_->start_breath()) {
+    ESP_LOGW(TAG, "Auto breath failed, fading VU meter backlights in software");
+    this->hardware_fades_ = false;
+    this->led_driver_->set_led_mode(TUNING_BACKLIGHT_CS, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+    this->led_driver_->set_led_mode(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+    this->led_driver_->set_pixel(TUNING_BACKLIGHT_CS, VU_METER_ROW, this->vu_meter_current_brightness_);
+    this->led_driver_->set_pixel(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, this->vu_meter_current_brightness_);
+    this->led_driver_->request_show();
+    return false;
+  }
+  this->led_driver_->request_show();
+  
+  this->vu_meter_current_brightness_ = target;
+  this->vu_meter_fading_ = true;
+  this->vu_meter_fade_start_ = millis();
+  this->vu_meter_fade_duration_ = breath.period_ms();
+  ESP_LOGD(TAG, "VU meter backlights fading in on the LED driver (%u ms)", this->vu_meter_fade_duration_);
+  return true;
+}
+
+void RadioController::finish_vu_meter_fade_() {
+  if (!this->vu_meter_fading_) {
+    return;
+  }
+  // Back to PWM mode at the level the fade ends on, so a later breath
+  // restart on another LED doesn't replay it
+  this->vu_meter_fading_ = false;
+  this->led_driver_->set_led_mode(TUNING_BACKLIGHT_CS, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+  this->led_driver_->set_led_mode(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+}
+
+void RadioController::update_memory_led_pulse_() {
+  if (!this->hardware_fades_ || !this->panel_leds_initialized_ || !this->led_driver_ ||
+      this->vu_meter_test_breathing_ || this->save_preset_mode_ == this->memory_led_pulsing_) {
+    return;
+  }
+  
+  if (this->save_preset_mode_) {
+    // Slow endless pulse at full brightness while waiting for a preset slot
+    this->finish_vu_meter_fade_();  // start_breath() would restart it
+    this->led_driver_->set_pixel(MEMORY_LED_CS, MEMORY_LED_SW, 255);
+    auto breath = esphome::retrotext_display::IS31FL3737Breath::pulse(420, 210, 420, 210);
+    if (!this->led_driver_->set_breath(ABM_MEMORY_LED, breath) ||
+        !this->led_driver_->set_led_mode(MEMORY_LED_CS, MEMORY_LED_SW, ABM_MEMORY_LED) ||
+        !this->led_driver_->start_breath()) {
+      ESP_LOGW(TAG, "Auto breath failed, memory LED stays steady");
+      this->led_driver_->set_led_mode(MEMORY_LED_CS, MEMORY_LED_SW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+      this->hardware_fades_ = false;
+      return;
+    }
+    this->led_driver_->request_show();
+  } else {
+    this->led_driver_->set_led_mode(MEMORY_LED_CS, MEMORY_LED_SW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+    // Save mode can end before the LEDs were refreshed for it
+    this->update_leds_for_browse_();
+  }
+  this->memory_led_pulsing_ = this->save_preset_mode_;
 }
 
 void RadioController::start_vu_meter_test() {
@@ -742,8 +901,40 @@ void RadioController::start_vu_meter_test() {
   this->vu_meter_test_active_ = true;
   this->vu_meter_test_start_ = millis();
   this->vu_meter_test_phase_ = 0;
+  this->vu_meter_test_breathing_ = false;
   
   ESP_LOGI(TAG, "Starting VU meter test - sweeping voltage across meters");
+  
+  if (!this->hardware_fades_) {
+    return;
+  }
+  
+  // Each meter pulses on its own ABM at roughly the software sweep rates,
+  // enough cycles to cover the 10 s test, ending off
+  constexpr uint32_t TEST_DURATION_MS = 10000;
+  constexpr uint32_t RAMP_MS[3] = {840, 1680, 420};
+  this->finish_vu_meter_fade_();
+  if (this->memory_led_pulsing_) {
+    // ABM-2 is borrowed; the pulse is re-armed after the test
+    this->led_driver_->set_led_mode(MEMORY_LED_CS, MEMORY_LED_SW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+    this->memory_led_pulsing_ = false;
+  }
+  bool ok = true;
+  for (uint8_t i = 0; i < 3 && ok; i++) {
+    auto breath = esphome::retrotext_display::IS31FL3737Breath::pulse(RAMP_MS[i], 0, RAMP_MS[i], 0);
+    breath.loops = (TEST_DURATION_MS + breath.period_ms() - 1) / breath.period_ms();
+    this->led_driver_->set_pixel(1 + i, VU_METER_ROW, 255);
+    ok = this->led_driver_->set_breath(1 + i, breath) && this->led_driver_->set_led_mode(1 + i, VU_METER_ROW, 1 + i);
+  }
+  if (ok && this->led_driver_->start_breath()) {
+    this->led_driver_->request_show();
+    this->vu_meter_test_breathing_ = true;
+  } else {
+    ESP_LOGW(TAG, "Auto breath failed, running VU meter test in software");
+    for (uint8_t i = 0; i < 3; i++) {
+      this->led_driver_->set_led_mode(1 + i, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+    }
+  }
 }
 
 void RadioController::update_vu_meter_slew_() {
@@ -758,6 +949,11 @@ void RadioController::update_vu_meter_slew_() {
   }
   this->last_vu_meter_update_ = now;
   
+  // Hardware fade in done: hand the backlights back to their PWM registers
+  if (this->vu_meter_fading_ && now - this->vu_meter_fade_start_ >= this->vu_meter_fade_duration_) {
+    this->finish_vu_meter_fade_();
+  }
+  
   // Handle VU meter test mode
   if (this->vu_meter_test_active_) {
     uint32_t test_duration = now - this->vu_meter_test_start_;
@@ -765,10 +961,23 @@ void RadioController::update_vu_meter_slew_() {
     // Test for 10 seconds, then stop
     if (test_duration > 10000) {
       this->vu_meter_test_active_ = false;
+      if (this->vu_meter_test_breathing_) {
+        this->vu_meter_test_breathing_ = false;
+        for (uint8_t cs = 1; cs <= 3; cs++) {
+          this->led_driver_->set_led_mode(cs, VU_METER_ROW, esphome::retrotext_display::IS31FL3737_LED_MODE_PWM);
+          this->led_driver_->set_pixel(cs, VU_METER_ROW, 0);
+        }
+        this->led_driver_->request_show();
+      }
       ESP_LOGI(TAG, "VU meter test completed");
       return;
     }
     
+    // The LED driver is animating the meters on its own
+    if (this->vu_meter_test_breathing_) {
+      return;
+    }
+    
     // Sweep across the 3 VU meters with different phases
     // VU Meter 1: SW2/CS1
     // VU Meter 2: SW2/CS2  
@@ -787,7 +996,7 @@ void RadioController::update_vu_meter_slew_() {
     this->led_driver_->set_pixel(2, 2, brightness2);  // SW2/CS2
     this->led_driver_->set_pixel(3, 2, brightness3);  // SW2/CS3 (bipolar)
     
-    this->led_driver_->show();
+    this->led_driver_->request_show();
     return;
   }
   
@@ -804,16 +1013,10 @@ void RadioController::update_vu_meter_slew_() {
     this->vu_meter_current_brightness_--;
   }
   
-  // VU meter backlight positions from HardwareConfig.h
-  // Row 2: "Tuning Backlight" at CS=9, "Signal Backlight" at CS=10
-  constexpr uint8_t VU_METER_ROW = 2;
-  constexpr uint8_t TUNING_BACKLIGHT_CS = 9;
-  constexpr uint8_t SIGNAL_BACKLIGHT_CS = 10;
-  
   // Update both backlight LEDs
   this->led_driver_->set_pixel(TUNING_BACKLIGHT_CS, VU_METER_ROW, this->vu_meter_current_brightness_);
   this->led_driver_->set_pixel(SIGNAL_BACKLIGHT_CS, VU_METER_ROW, this->vu_meter_current_brightness_);
-  this->led_driver_->show();
+  this->led_driver_->request_show();
   
   ESP_LOGV(TAG, "VU meter brightness: %d -> %d", 
            this->vu_meter_current_brightness_, this->vu_meter_target_brightness_);
@@ -822,46 +1025,108 @@ void RadioController::update_vu_meter_slew_() {
 // Playlist Browsing Methods
 
 void RadioController::load_playlist_data(const std::string &json_data) {
-  ESP_LOGI(TAG, "Loading playlist data: %s", json_data.c_str());
+  ESP_LOGI(TAG, "Loading playlist data (%u bytes)", (unsigned) json_data.size());
+  ESP_LOGV(TAG, "Playlist JSON: %s", json_data.c_str());
   
   // Clear existing playlists
-  this->playlists_.clear();
+  this->release_items_(this->playlists_);
   this->playlist_index_ = 0;
   
-  // Parse JSON using ArduinoJson (6.x compatible)
-  DynamicJsonDocument doc(8192);
-  DeserializationError error = deserializeJson(doc, json_data);
+  // Expect array of objects: [{"name": "...", "uri": "..."}, ...]
+  this->parse_favorites_(json_data, this->playlists_, "playlists");
   
-  if (error) {
-    ESP_LOGE(TAG, "Failed to parse JSON: %s", error.c_str());
-    return;
-  }
+  // Replace the playlists segment of the browse list
+  this->replace_browse_segment_(BrowseItem::PLAYLIST);
+}
+
+bool RadioController::parse_favorites_(const std::string &json_data, std::vector<PlaylistItem> &items,
+                                       const char *what) {
+  // Entries go straight into the list as they are read; no document is built
+  FavoritesParser parser([this, &items](const char *name, size_t name_length, const char *uri, size_t uri_length) {
+    PlaylistItem item;
+    item.name = this->strings_.add(name, name_length);
+    item.uri = this->strings_.add(uri, uri_length);
+    ESP_LOGV(TAG, "Added: %s", name);
+    items.push_back(item);
+  });
   
-  // Expect array of objects: [{"name": "...", "uri": "..."}, ...]
-  if (doc.is<JsonArray>()) {
-    JsonArray array = doc.as<JsonArray>();
-    
-    for (JsonVariant item : array) {
-      if (item.is<JsonObject>()) {
-        JsonObject obj = item.as<JsonObject>();
-        
-        // Check if both name and uri fields exist
-        if (obj["name"].is<const char*>() && obj["uri"].is<const char*>()) {
-          PlaylistItem playlist;
-          playlist.name = obj["name"].as<std::string>();
-          playlist.uri = obj["uri"].as<std::string>();
-          this->playlists_.push_back(playlist);
-          
-          ESP_LOGD(TAG, "Added playlist: %s", playlist.name.c_str());
-        }
+  uint32_t start = micros();
+  bool ok = parser.feed(json_data.data(), json_data.size()) && parser.finish();
+  uint32_t elapsed = micros() - start;
+  
+  size_t list_bytes = items.capacity() * sizeof(PlaylistItem);
+  if (!ok) {
+    ESP_LOGE(TAG, "Failed to parse %s JSON at byte %u: %s (keeping %u read before it)", what,
+             (unsigned) parser.get_offset(), parser.get_error(), (unsigned) items.size());
+  }
+  ESP_LOGI(TAG, "Loaded %u %s from %u bytes in %u us (%u skipped, %u names truncated)", (unsigned) items.size(), what,
+           (unsigned) json_data.size(), (unsigned) elapsed, (unsigned) parser.get_skipped(),
+           (unsigned) parser.get_truncated());
+  ESP_LOGD(TAG, "Parser working memory %u bytes, %s list %u bytes, string arena %u bytes",
+           (unsigned) sizeof(FavoritesParser), what, (unsigned) list_bytes, (unsigned) this->strings_.get_size());
+  return ok;
+}
+
+void RadioController::release_items_(std::vector<PlaylistItem> &items) {
+  for (const auto &item : items) {
+    this->strings_.release(item.name);
+    this->strings_.release(item.uri);
+  }
+  items.clear();
+}
+
+void RadioController::compact_strings_() {
+  // Preset slots and the separator own their strings; playlists and favorites
+  // share their source list's, so only the sources are visited for those
+  size_t before = this->strings_.get_size();
+  this->strings_.compact([this](auto &&visit) {
+    for (auto &item : this->browse_items_) {
+      if (item.type == BrowseItem::PRESET) {
+        visit(item.name);
+        visit(item.target);
       }
     }
+    for (auto &item : this->playlists_) {
+      visit(item.name);
+      visit(item.uri);
+    }
+    for (auto &item : this->favorites_.get_items()) {
+      visit(item.name);
+      visit(item.uri);
+    }
+  });
+  // Point the shared browse items at the moved strings
+  reshare_browse_segment(this->browse_items_, BrowseItem::PLAYLIST, this->playlists_);
+  reshare_browse_segment(this->browse_items_, BrowseItem::FAVORITE, this->favorites_.get_items());
+  ESP_LOGD(TAG, "Compacted string arena: %u -> %u bytes", (unsigned) before, (unsigned) this->strings_.get_size());
+}
+
+// Heap a std::string copy of `length` chars would need beyond the object (SSO holds up to 15)
+static size_t std_string_heap(size_t length) { return length > 15 ? length + 1 : 0; }
+
+void RadioController::dump_browse_memory_() {
+  size_t items = this->browse_items_.size();
+  if (items == 0) {
+    return;
   }
+  const std::vector<PlaylistItem> &favorites = this->favorites_.get_items();
+  size_t sources = this->playlists_.size() + favorites.size();
+  size_t bytes = this->browse_items_.capacity() * sizeof(BrowseItem) +
+                 (this->playlists_.capacity() + favorites.capacity()) * sizeof(PlaylistItem) +
+                 this->strings_.get_capacity();
   
-  ESP_LOGI(TAG, "Loaded %d playlists", this->playlists_.size());
+  // The same content as std::string copies in both the source lists and the browse list
+  // (type, preset index and button position took 12 bytes next to the two strings)
+  size_t copies = items * (2 * sizeof(std::string) + 12) + sources * 2 * sizeof(std::string);
+  for (const auto &item : this->browse_items_) {
+    size_t heap = std_string_heap(item.name.length) + std_string_heap(item.target.length);
+    copies += item.type == BrowseItem::PRESET ? heap : 2 * heap;
+  }
   
-  // Rebuild browse list to include new playlists
-  build_browse_list_();
+  ESP_LOGCONFIG(TAG, "  Browse Memory: %u items, %u bytes/item (string arena %u bytes, %u reclaimable); "
+                "%u bytes/item as std::string copies",
+                (unsigned) items, (unsigned) (bytes / items), (unsigned) this->strings_.get_size(),
+                (unsigned) this->strings_.get_garbage(), (unsigned) (copies / items));
 }
 
 // ============================================================================
@@ -869,83 +1134,79 @@ void RadioController::load_playlist_data(const std::string &json_data) {
 // ============================================================================
 
 void RadioController::build_browse_list_() {
+  // Full build at setup; afterwards slots are patched and segments replaced
   browse_items_.clear();
+  browse_items_.resize(BROWSE_PRESET_SLOTS);
+  for (uint8_t i = 0; i < BROWSE_PRESET_SLOTS; i++) {
+    this->fill_browse_preset_(browse_items_[i], i);
+  }
+  this->replace_browse_segment_(BrowseItem::PLAYLIST);
+  this->replace_browse_segment_(BrowseItem::FAVORITE);
+}
+
+void RadioController::fill_browse_preset_(BrowseItem &item, uint8_t slot) {
+  const StoredPreset &stored = stored_presets_[slot];
+  
+  item.id = 1 + slot;
+  item.type = BrowseItem::PRESET;
+  item.preset_index = slot;
+  
+  // Use stored preset if valid, otherwise fall back to YAML preset
+  if (stored.is_valid) {
+    item.name = this->strings_.add(stored.display_name);
+    item.target = this->strings_.add(stored.media_id);
+  } else if (slot < this->presets_.size()) {
+    // Use YAML preset when stored preset is invalid/empty
+    item.name = this->strings_.add(this->presets_[slot].display_text);
+    item.target = this->strings_.add(this->presets_[slot].target);
+  } else {
+    // No YAML preset either - truly empty
+    item.name = this->strings_.add(stored.display_name);  // "Empty Slot X"
+    item.target = ArenaString{};
+  }
   
-  // Add all 7 preset slots (including empty ones)
-  for (uint8_t i = 0; i < 7; i++) {
-    const StoredPreset &stored = stored_presets_[i];
-    
-    BrowseItem item;
-    item.type = BrowseItem::PRESET;
-    
-    // Use stored preset if valid, otherwise fall back to YAML preset
-    if (stored.is_valid) {
-      item.name = stored.display_name;
-      item.target = stored.media_id;
-    } else if (i < this->presets_.size()) {
-      // Use YAML preset when stored preset is invalid/empty
-      item.name = this->presets_[i].display_text;
-      item.target = this->presets_[i].target;
-    } else {
-      // No YAML preset either - truly empty
-      item.name = stored.display_name;  // "Empty Slot X"
-      item.target = "";
-    }
-    
-    item.preset_index = i;
-    
-    // Find row/column from runtime presets if available
-    if (i < this->presets_.size()) {
-      item.row = this->presets_[i].row;
-      item.column = this->presets_[i].column;
-    } else {
-      item.row = 0;
-      item.column = 0;
-    }
-    
-    browse_items_.push_back(item);
-  }
-  
-  // Add separator if we have additional content
-  if (!this->playlists_.empty() || !this->all_favorites_.empty()) {
-    BrowseItem separator;
-    separator.type = BrowseItem::PRESET;  // Use PRESET type for separators
-    separator.name = "--- ALL FAVORITES ---";
-    separator.target = "";
-    separator.preset_index = -1;
-    separator.row = 0;
-    separator.column = 0;
-    browse_items_.push_back(separator);
-  }
-  
-  // Add all playlists
-  for (const auto &playlist : this->playlists_) {
-    BrowseItem item;
-    item.type = BrowseItem::PLAYLIST;
-    item.name = playlist.name;
-    item.target = playlist.uri;
-    item.preset_index = -1;  // Not a preset
-    item.row = 0;
-    item.column = 0;
-    browse_items_.push_back(item);
-  }
-  
-  // Add all favorites (radios + additional playlists from MA)
-  for (const auto &fav : this->all_favorites_) {
-    BrowseItem item;
-    item.type = BrowseItem::FAVORITE;
-    item.name = fav.name;
-    item.target = fav.uri;
-    item.preset_index = -1;  // Not a preset slot
-    item.row = 0;
-    item.column = 0;
-    browse_items_.push_back(item);
-  }
-  
-  ESP_LOGI(TAG, "Built browse list: %d items (7 preset slots, %d playlists, %d favorites)",
-           browse_items_.size(), 
-           this->playlists_.size(),
-           this->all_favorites_.size());
+  // Find row/column from runtime presets if available
+  if (slot < this->presets_.size()) {
+    item.row = this->presets_[slot].row;
+    item.column = this->presets_[slot].column;
+  }
+}
+
+void RadioController::update_browse_preset_(uint8_t slot) {
+  uint32_t start = micros();
+  BrowseItem &item = browse_items_[slot];
+  this->strings_.release(item.name);
+  this->strings_.release(item.target);
+  this->fill_browse_preset_(item, slot);
+  ESP_LOGD(TAG, "Browse list: preset slot %d updated in %u us", slot + 1, (unsigned) (micros() - start));
+}
+
+void RadioController::replace_browse_segment_(BrowseItem::Type type) {
+  uint32_t start = micros();
+  
+  // The segment's strings belong to its source list (released when it was reloaded)
+  const std::vector<PlaylistItem> &source =
+      type == BrowseItem::PLAYLIST ? this->playlists_ : this->favorites_.get_items();
+  bool was_playing = currently_playing_index_ >= 0;
+  replace_browse_segment(browse_items_, type, source, this->strings_, browse_index_, currently_playing_index_);
+  if (was_playing && currently_playing_index_ < 0) {
+    ESP_LOGD(TAG, "Browse list: playing item is no longer listed");
+  }
+  
+  if (this->strings_.get_garbage() > this->strings_.get_live()) {
+    this->compact_strings_();
+  }
+  if (type == BrowseItem::FAVORITE) {
+    this->favorites_letters_.build(source.size(), [this, &source](size_t i) { return this->text_(source[i].name); });
+  }
+  
+  ESP_LOGI(TAG, "Browse list: %u %s replaced in %u us (%u items: %d presets, %u playlists, %u favorites)",
+           (unsigned) source.size(), type == BrowseItem::PLAYLIST ? "playlists" : "favorites",
+           (unsigned) (micros() - start), (unsigned) browse_items_.size(), BROWSE_PRESET_SLOTS,
+           (unsigned) this->playlists_.size(), (unsigned) this->favorites_.get_items().size());
+  ESP_LOGD(TAG, "Browse list strings: %u bytes in the arena (%u reclaimable), favorites under %u letters",
+           (unsigned) this->strings_.get_size(), (unsigned) this->strings_.get_garbage(),
+           this->favorites_letters_.get_groups());
 }
 
 void RadioController::enter_browse_mode_() {
@@ -960,9 +1221,9 @@ void RadioController::enter_browse_mode_() {
       
       // Add icon only if this is the currently playing item
       if ((int)browse_index_ == currently_playing_index_) {
-        display_text = this->format_display_text_(browse_items_[browse_index_].name);
+        display_text = this->format_display_text_(this->text_(browse_items_[browse_index_].name));
       } else {
-        display_text = browse_items_[browse_index_].name;
+        display_text = this->text_(browse_items_[browse_index_].name);
       }
       
       this->display_->set_text(display_text.c_str());
@@ -996,8 +1257,8 @@ void RadioController::exit_browse_mode_() {
         this->display_->set_text(display_text.c_str());  // RetroText auto-scrolls long text
       } else {
         // Show station name (with play or stop icon)
-        ESP_LOGD(TAG, "Showing station: %s", browse_items_[currently_playing_index_].name.c_str());
-        std::string display_text = this->format_display_text_(browse_items_[currently_playing_index_].name);
+        ESP_LOGD(TAG, "Showing station: %s", this->text_(browse_items_[currently_playing_index_].name));
+        std::string display_text = this->format_display_text_(this->text_(browse_items_[currently_playing_index_].name));
         this->display_->set_text(display_text.c_str());
       }
     }
@@ -1013,7 +1274,7 @@ void RadioController::exit_browse_mode_() {
   ESP_LOGI(TAG, "Exited browse mode");
 }
 
-void RadioController::scroll_browse_(int direction) {
+void RadioController::scroll_browse_(int delta) {
   if (browse_items_.empty()) {
     return;
   }
@@ -1025,16 +1286,159 @@ void RadioController::scroll_browse_(int direction) {
   
   this->last_browse_interaction_ = millis();
   
-  // Update index with wrapping
+  // Update index with wrapping; while more favorites are still to be paged
+  // in, stop at the ends instead (the list's real end isn't loaded)
+  int size = (int) browse_items_.size();
+  int index = (int) browse_index_ + delta;
+  if (this->favorites_more_after_()) {
+    index = std::max(0, std::min(index, size - 1));
+  } else {
+    index %= size;
+    if (index < 0) {
+      index += size;
+    }
+  }
+  // Likewise at the window's first favorite while earlier ones are paged out
+  auto range = browse_segment(browse_items_, BrowseItem::FAVORITE);
+  if (delta < 0 && this->favorites_more_before_() && browse_index_ >= range.first && index < (int) range.first) {
+    index = range.first;
+  }
+  browse_index_ = index;
+  
+  this->prefetch_favorites_();
+  this->show_browse_item_();
+}
+
+char RadioController::browse_initial_(size_t index) const {
+  return name_initial(this->text_(browse_items_[index].name));
+}
+
+void RadioController::jump_browse_group_(int direction) {
+  if (browse_items_.empty()) {
+    return;
+  }
+  
+  // Forward: first item with a different initial. Backward: first item of
+  // the previous group (or of this one, if we're not already at its start).
+  size_t size = browse_items_.size();
+  size_t index = browse_index_;
+  char initial = this->browse_initial_(index);
+  size_t moved = 0;
   if (direction > 0) {
-    browse_index_ = (browse_index_ + 1) % browse_items_.size();
-  } else if (direction < 0) {
-    if (browse_index_ == 0) {
-      browse_index_ = browse_items_.size() - 1;
-    } else {
-      browse_index_--;
+    while (moved < size && this->browse_initial_(index) == initial) {
+      index = (index + 1) % size;
+      moved++;
+    }
+  } else {
+    size_t prev = (index + size - 1) % size;
+    if (this->browse_initial_(prev) != initial) {
+      // Already at the start of a group: step into the previous one
+      index = prev;
+      initial = this->browse_initial_(index);
+    }
+    while (moved < size && this->browse_initial_((index + size - 1) % size) == initial) {
+      index = (index + size - 1) % size;
+      moved++;
+    }
+  }
+  if (direction > 0 && index < browse_index_ && this->favorites_more_after_()) {
+    // Ran off the loaded window: stop at its end, the next page is on its way
+    index = size - 1;
+  } else if (direction < 0 && index > browse_index_ && this->favorites_more_after_()) {
+    index = 0;
+  }
+  auto range = browse_segment(browse_items_, BrowseItem::FAVORITE);
+  if (direction < 0 && this->favorites_more_before_() && browse_index_ >= range.first &&
+      (index < range.first || index > browse_index_)) {
+    // Ran off the window's start: stop at its first favorite for the previous page
+    index = range.first;
+  }
+  if (moved >= size || index == browse_index_) {
+    // Only one group in the list
+    this->scroll_browse_(direction);
+    return;
+  }
+  
+  this->encoder_group_jumps_++;
+  ESP_LOGD(TAG, "Encoder: group jump '%c' -> '%c'", this->browse_initial_(browse_index_),
+           this->browse_initial_(index));
+  this->scroll_browse_((int) index - (int) browse_index_);
+}
+
+void RadioController::jump_browse_letter_(int direction) {
+  auto range = browse_segment(this->browse_items_, BrowseItem::FAVORITE);
+  if (range.first == range.second) {
+    // No favorites: move through the presets by group
+    this->jump_browse_group_(direction);
+    return;
+  }
+  
+  // Forward: first favorite of the next letter (from the radios' Z on into
+  // the playlists' A). Backward: first favorite of this letter, or of the
+  // previous one if we're already there. Stops at the first and last
+  // letter; before the favorites, forward enters them. With favorites_paging
+  // the letters are the loaded window's: past its last (or first) one the
+  // jump waits at the window's edge for the next page and carries on from
+  // there while the button is still held.
+  uint16_t target;
+  if (browse_index_ < range.first || browse_index_ >= range.second) {
+    if (direction < 0) {
+      this->jump_browse_group_(direction);
+      return;
+    }
+    target = 0;
+  } else {
+    size_t position = browse_index_ - range.first;
+    target = direction > 0 ? this->favorites_letters_.next(position) : this->favorites_letters_.previous(position);
+  }
+  if (!browse_mode_active_) {
+    enter_browse_mode_();
+  }
+  this->last_browse_interaction_ = millis();
+  // Past the first or last letter the selection stays put, unless more
+  // favorites are paged out that way
+  bool more = direction > 0 ? this->favorites_more_after_() : this->favorites_more_before_();
+  this->letter_jump_pending_ = 0;
+  if (target != LETTER_NONE) {
+    browse_index_ = range.first + target;
+    this->encoder_letter_jumps_++;
+  } else if (more && browse_index_ >= range.first) {
+    browse_index_ = direction > 0 ? range.second - 1 : range.first;
+    this->letter_jump_pending_ = direction;
+  }
+  this->prefetch_favorites_();
+  
+  // The letter ahead of the name while the button is held; an arrow marks
+  // more letters in pages still to come
+  char initial = letter_group_initial(letter_group(this->browse_initial_(browse_index_)));
+  if (this->display_ != nullptr) {
+    std::string letter(1, initial);
+    if (this->letter_jump_pending_ > 0) {
+      letter += '>';
+    } else if (this->letter_jump_pending_ < 0) {
+      letter.insert(0, 1, '<');
     }
+    std::string text = letter + ": " + this->text_(browse_items_[browse_index_].name);
+    this->display_->set_text(text.c_str());
+    this->last_browse_draw_ms_ = millis();
   }
+  ESP_LOGI(TAG, "Letter jump to '%c': %d/%d - %s", initial, browse_index_ + 1,
+           browse_items_.size(), this->text_(browse_items_[browse_index_].name));
+  this->update_leds_for_browse_();
+}
+
+void RadioController::show_browse_item_() {
+  // During a fast spin only the landing item needs drawing; update_browse_spin_()
+  // draws it once the knob settles (plus occasional progress redraws)
+  uint32_t now = millis();
+  if (this->encoder_acceleration_.is_spinning() &&
+      (this->spin_redraw_interval_ms_ == 0 || now - this->last_browse_draw_ms_ < this->spin_redraw_interval_ms_)) {
+    this->browse_redraw_pending_ = true;
+    this->browse_redraws_skipped_++;
+    return;
+  }
+  this->browse_redraw_pending_ = false;
+  this->last_browse_draw_ms_ = now;
   
   // Update display
   // Show play/stop icon ONLY if this is the currently playing station
@@ -1044,21 +1448,33 @@ void RadioController::scroll_browse_(int direction) {
     
     // Add icon only if this is the currently playing item
     if ((int)browse_index_ == currently_playing_index_) {
-      display_text = this->format_display_text_(item.name);
+      display_text = this->format_display_text_(this->text_(item.name));
     } else {
-      display_text = item.name;
+      display_text = this->text_(item.name);
     }
     
     this->display_->set_text(display_text.c_str());
     ESP_LOGI(TAG, "Browsing: %d/%d - %s%s", 
              browse_index_ + 1, browse_items_.size(), 
              ((int)browse_index_ == currently_playing_index_) ? "[PLAYING] " : "",
-             item.name.c_str());
+             this->text_(item.name));
   }
   
   update_leds_for_browse_();
 }
 
+void RadioController::update_browse_spin_() {
+  if (!this->encoder_acceleration_.is_spinning() || millis() - this->last_detent_ms_ < this->spin_settle_ms_) {
+    return;
+  }
+  // Knob stopped: the next detent starts slow again, and the landing item is drawn
+  this->encoder_acceleration_.reset();
+  if (this->browse_redraw_pending_ && this->browse_mode_active_) {
+    this->show_browse_item_();
+  }
+  this->browse_redraw_pending_ = false;
+}
+
 void RadioController::update_leds_for_browse_() {
   if (!this->panel_leds_initialized_ || !this->led_driver_) {
     return;
@@ -1129,14 +1545,14 @@ void RadioController::update_leds_for_browse_() {
     this->led_driver_->set_pixel(5, 3, 0);
   }
   
-  this->led_driver_->show();
+  this->led_driver_->request_show();
 }
 
 void RadioController::toggle_play_stop_() {
   // PRIORITY 1: If browsing a DIFFERENT station, play it (even if something else is playing)
   if (browse_mode_active_ && browse_index_ < browse_items_.size() && 
       (int)browse_index_ != currently_playing_index_) {
-    ESP_LOGI(TAG, "Encoder button: switching to new station: %s", browse_items_[browse_index_].name.c_str());
+    ESP_LOGI(TAG, "Encoder button: switching to new station: %s", this->text_(browse_items_[browse_index_].name));
     play_browse_item_(browse_index_);
     return;
   }
@@ -1150,7 +1566,7 @@ void RadioController::toggle_play_stop_() {
     // Update display with stop icon
     if (this->display_ != nullptr) {
       if (currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
-        std::string display_text = this->format_display_text_(browse_items_[currently_playing_index_].name);
+        std::string display_text = this->format_display_text_(this->text_(browse_items_[currently_playing_index_].name));
         this->display_->set_text(display_text.c_str());
       } else {
         std::string display_text = this->format_display_text_("STOPPED");
@@ -1172,16 +1588,16 @@ void RadioController::toggle_play_stop_() {
              browse_mode_active_, browse_index_, currently_playing_index_);
     
     if (browse_mode_active_ && browse_index_ < browse_items_.size()) {
-      ESP_LOGI(TAG, "Encoder button: playing selection: %s", browse_items_[browse_index_].name.c_str());
+      ESP_LOGI(TAG, "Encoder button: playing selection: %s", this->text_(browse_items_[browse_index_].name));
       play_browse_item_(browse_index_);
     } else if (currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
       const auto &item = browse_items_[currently_playing_index_];
-      ESP_LOGI(TAG, "Encoder button: resuming: %s (target: %s)", item.name.c_str(), item.target.c_str());
+      ESP_LOGI(TAG, "Encoder button: resuming: %s (target: %s)", this->text_(item.name), this->text_(item.target));
       
       is_playing_ = true;
       
       if (this->display_ != nullptr) {
-        std::string display_text = this->format_display_text_(item.name);
+        std::string display_text = this->format_display_text_(this->text_(item.name));
         this->display_->set_text(display_text.c_str());
       }
       
@@ -1189,8 +1605,8 @@ void RadioController::toggle_play_stop_() {
       this->set_vu_meter_target_brightness(204);
       
       if (this->preset_target_sensor_ != nullptr) {
-        this->preset_target_sensor_->publish_state(item.target);
-        ESP_LOGD(TAG, "Re-published media_id for resume: '%s'", item.target.c_str());
+        this->preset_target_sensor_->publish_state(this->text_(item.target));
+        ESP_LOGD(TAG, "Re-published media_id for resume: '%s'", this->text_(item.target));
       }
     } else {
       ESP_LOGW(TAG, "Cannot resume: no valid station (currently_playing_index=%d, browse_items size=%d)",
@@ -1207,8 +1623,8 @@ void RadioController::play_browse_item_(size_t index) {
   const auto &item = browse_items_[index];
   
   // Check if this is an empty preset slot or separator
-  if (item.target.empty() || item.name.find("---") == 0) {
-    ESP_LOGW(TAG, "Cannot play empty or separator item: %s", item.name.c_str());
+  if (item.target.empty() || strncmp(this->text_(item.name), "---", 3) == 0) {
+    ESP_LOGW(TAG, "Cannot play empty or separator item: %s", this->text_(item.name));
     if (this->display_ != nullptr) {
       this->display_->set_text("EMPTY SLOT");
       // Stay in browse mode, don't exit
@@ -1216,7 +1632,7 @@ void RadioController::play_browse_item_(size_t index) {
     return;
   }
   
-  ESP_LOGI(TAG, "Playing item: %s (target: %s)", item.name.c_str(), item.target.c_str());
+  ESP_LOGI(TAG, "Playing item: %s (target: %s)", this->text_(item.name), this->text_(item.target));
   
   // Update state
   currently_playing_index_ = index;
@@ -1233,19 +1649,19 @@ void RadioController::play_browse_item_(size_t index) {
   
   // Update display with station name (with play icon)
   if (this->display_ != nullptr) {
-    std::string display_text = this->format_display_text_(item.name);
+    std::string display_text = this->format_display_text_(this->text_(item.name));
     this->display_->set_text(display_text.c_str());
     ESP_LOGD(TAG, "Display updated: '%s' (will show station name for 3 seconds)", display_text.c_str());
   }
   
   // Update text sensors for Home Assistant
   if (this->preset_text_sensor_ != nullptr) {
-    this->preset_text_sensor_->publish_state(item.name);
+    this->preset_text_sensor_->publish_state(this->text_(item.name));
   }
   
   if (this->preset_target_sensor_ != nullptr) {
-    this->preset_target_sensor_->publish_state(item.target);
-    ESP_LOGD(TAG, "Published media_id: '%s'", item.target.c_str());
+    this->preset_target_sensor_->publish_state(this->text_(item.target));
+    ESP_LOGD(TAG, "Published media_id: '%s'", this->text_(item.target));
   }
   
   // Update LEDs
@@ -1346,12 +1762,12 @@ void RadioController::set_playback_state(bool playing) {
     } else if (playing && currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
       // Playing but no real metadata yet - show station name with play icon
       ESP_LOGD(TAG, "Display: station name with play icon");
-      std::string display_text = this->format_display_text_(browse_items_[currently_playing_index_].name);
+      std::string display_text = this->format_display_text_(this->text_(browse_items_[currently_playing_index_].name));
       this->display_->set_text(display_text.c_str());
     } else if (!playing && currently_playing_index_ >= 0 && currently_playing_index_ < (int)browse_items_.size()) {
       // Stopped - show station name with stop icon
       ESP_LOGD(TAG, "Display: station name with stop icon");
-      std::string display_text = this->format_display_text_(browse_items_[currently_playing_index_].name);
+      std::string display_text = this->format_display_text_(this->text_(browse_items_[currently_playing_index_].name));
       this->display_->set_text(display_text.c_str());
     } else {
       // Fallback
@@ -1439,8 +1855,8 @@ void RadioController::save_preset_to_slot(uint8_t slot, const std::string &media
   // Note: Individual preset slot sensors removed
   // Preset saved successfully - will appear in select component
   
-  // Rebuild browse list to reflect changes
-  this->build_browse_list_();
+  // Patch the slot in the browse list
+  this->update_browse_preset_(slot);
   
   // Update select options
   this->update_preset_select_options_();
@@ -1491,8 +1907,8 @@ void RadioController::clear_preset_slot(uint8_t slot) {
   // Note: Individual preset slot sensors removed
   // Cleared slot will show as empty in select component
   
-  // Rebuild browse list
-  this->build_browse_list_();
+  // Patch the slot in the browse list
+  this->update_browse_preset_(slot);
   
   // Update select options
   this->update_preset_select_options_();
@@ -1550,41 +1966,123 @@ void RadioController::set_memory_button(uint8_t row, uint8_t column) {
 // ====================================================================================
 
 void RadioController::load_all_favorites(const std::string &json_data) {
-  ESP_LOGI(TAG, "Loading all favorites from JSON...");
+  ESP_LOGI(TAG, "Loading all favorites from JSON (%u bytes)...", (unsigned) json_data.size());
+  
+  std::vector<PlaylistItem> favorites;
+  if (!this->parse_favorites_(json_data, favorites, "favorites")) {
+    // Half a list would replace the whole one; keep what is shown
+    ESP_LOGW(TAG, "Keeping the current %u favorites", (unsigned) this->favorites_.get_items().size());
+    this->release_items_(favorites);
+    return;
+  }
+  // The whole list replaces the existing favorites: nothing left to page in
+  this->favorites_.load_all(favorites, this->strings_);
   
-  // Parse JSON using ArduinoJson (6.x compatible)
-  DynamicJsonDocument doc(8192);
-  DeserializationError error = deserializeJson(doc, json_data);
+  // Replace the favorites segment of the browse list
+  this->replace_browse_segment_(BrowseItem::FAVORITE);
+}
+
+// ====================================================================================
+// Favorites Paging
+// ====================================================================================
+
+void RadioController::load_favorites_page(int32_t offset, int32_t limit, int32_t radios,
+                                          const std::string &json_data) {
+  if (this->favorites_page_event_.empty()) {
+    // One page would replace the whole list, and nothing asks for the rest
+    ESP_LOGW(TAG, "Ignoring favorites page: favorites_paging is not configured (send load_all_favorites instead)");
+    return;
+  }
+  if (offset < 0 || limit <= 0) {
+    ESP_LOGW(TAG, "Ignoring favorites page at offset %d, limit %d", (int) offset, (int) limit);
+    return;
+  }
   
-  if (error) {
-    ESP_LOGE(TAG, "Failed to parse all favorites JSON: %s", error.c_str());
+  std::vector<PlaylistItem> page;
+  if (!this->parse_favorites_(json_data, page, "favorites page")) {
+    // A cut-off page would read as the short last one; the request stays
+    // pending so the timeout asks for it again
+    ESP_LOGW(TAG, "Dropping favorites page at offset %d", (int) offset);
+    this->release_items_(page);
     return;
   }
+  if (offset == this->favorites_request_offset_) {
+    this->favorites_request_offset_ = -1;
+  }
+  if (radios >= 0) {
+    this->favorites_radios_ = radios;
+  }
   
-  // Clear existing favorites
-  all_favorites_.clear();
+  // Fewer items than the echoed limit means the list ends with this page
+  this->favorites_pages_loaded_++;
+  bool changed = this->favorites_.add_page(offset, std::min<int32_t>(limit, UINT16_MAX), page, this->strings_);
   
-  // Parse items array
-  if (!doc.is<JsonArray>()) {
-    ESP_LOGE(TAG, "All favorites JSON is not an array");
+  ESP_LOGD(TAG, "Favorites window %u-%u of %d%s", (unsigned) this->favorites_.get_offset(),
+           (unsigned) this->favorites_.get_end(), (int) this->favorites_.get_total(),
+           changed ? "" : " (page already loaded)");
+  if (changed) {
+    this->replace_browse_segment_(BrowseItem::FAVORITE);
+    if (this->letter_jump_pending_ != 0 && this->encoder_button_held_) {
+      // The letter jump that ran off the window goes on into the new page
+      this->jump_browse_letter_(this->letter_jump_pending_);
+    }
+  }
+  
+  // Still near an edge (fast scrolling, or the window was empty)
+  this->prefetch_favorites_();
+}
+
+bool RadioController::favorites_more_after_() const {
+  return !this->favorites_page_event_.empty() && this->favorites_.has_more_after();
+}
+
+bool RadioController::favorites_more_before_() const {
+  return !this->favorites_page_event_.empty() && this->favorites_.get_offset() > 0;
+}
+
+void RadioController::prefetch_favorites_() {
+  if (this->favorites_page_event_.empty() || this->favorites_.get_total() == 0) {
+    return;
+  }
+  if (this->favorites_.get_items().empty()) {
+    this->request_favorites_page_(0, this->favorites_page_size_);
     return;
   }
   
-  JsonArray items = doc.as<JsonArray>();
-  for (JsonObject item : items) {
-    if (item["name"].is<const char*>() && item["uri"].is<const char*>()) {
-      PlaylistItem fav;
-      fav.name = item["name"].as<std::string>();
-      fav.uri = item["uri"].as<std::string>();
-      all_favorites_.push_back(fav);
-      ESP_LOGD(TAG, "Loaded favorite: %s", fav.name.c_str());
+  auto range = browse_segment(this->browse_items_, BrowseItem::FAVORITE);
+  if (this->browse_index_ < range.first) {
+    // Before the favorites: the next pass through them starts at the top
+    if (this->favorites_.get_offset() > 0) {
+      this->request_favorites_page_(0, this->favorites_page_size_);
     }
+    return;
   }
   
-  ESP_LOGI(TAG, "Loaded %d favorites from Music Assistant", all_favorites_.size());
+  size_t position = this->browse_index_ - range.first;
+  size_t size = range.second - range.first;
+  if (position + this->favorites_prefetch_ >= size && this->favorites_more_after_()) {
+    this->request_favorites_page_(this->favorites_.get_end(), this->favorites_page_size_);
+  } else if (position < this->favorites_prefetch_ && this->favorites_.get_offset() > 0) {
+    uint16_t limit = std::min<uint32_t>(this->favorites_page_size_, this->favorites_.get_offset());
+    this->request_favorites_page_(this->favorites_.get_offset() - limit, limit);
+  }
+}
+
+void RadioController::request_favorites_page_(uint32_t offset, uint16_t limit) {
+  // One page in flight at a time
+  uint32_t now = millis();
+  if (this->favorites_request_offset_ >= 0 && now - this->favorites_request_ms_ < FAVORITES_PAGE_TIMEOUT_MS) {
+    return;
+  }
+  this->favorites_request_offset_ = offset;
+  this->favorites_request_ms_ = now;
   
-  // Rebuild browse list to include all favorites
-  this->build_browse_list_();
+  ESP_LOGD(TAG, "Requesting favorites %u-%u", (unsigned) offset, (unsigned) (offset + limit));
+  this->fire_home_assistant_event_(this->favorites_page_event_, {
+      {"offset", std::to_string(offset)},
+      {"limit", std::to_string(limit)},
+      {"radios", std::to_string(this->favorites_radios_)},
+  });
 }
 
 }  // namespace radio_controller
@@ -7,9 +7,23 @@
 #include "esphome/components/tca8418_keypad/tca8418_keypad.h"
 #include "esphome/components/retrotext_display/retrotext_display.h"
 #include "esphome/components/api/custom_api_device.h"
+#include "browse_list.h"
+#include "encoder_acceleration.h"
+#include "favorites_parser.h"
+#include "favorites_window.h"
+#include "key_dispatch.h"
+#include "letter_index.h"
+#include "quadrature_decoder.h"
+#include "string_arena.h"
+#include <map>
+#include <utility>
 #include <vector>
 #include <string>
 
+#ifdef USE_I2C_ARBITER
+#include "esphome/components/i2c_arbiter/i2c_arbiter.h"
+#endif
+
 namespace esphome {
 
 // Forward declarations for optional components
@@ -45,17 +59,6 @@ struct StoredPreset {
   uint32_t last_played;      // Timestamp for recently played sorting
 };
 
-// New unified browse item structure
-struct BrowseItem {
-  enum Type { PRESET, PLAYLIST, FAVORITE };
-  Type type;
-  std::string name;          // Display name
-  std::string target;        // Media ID / URI
-  int preset_index;          // -1 if not a preset, 0-6 for presets (7 total)
-  uint8_t row;              // For presets, original button position
-  uint8_t column;
-};
-
 class RadioController : public Component {
  public:
   void setup() override;
@@ -66,6 +69,10 @@ class RadioController : public Component {
   void set_keypad(tca8418_keypad::TCA8418Component *keypad) { this->keypad_ = keypad; }
   void set_display(retrotext_display::RetroTextDisplay *display) { this->display_ = display; }
   void set_i2c_bus(i2c::I2CBus *bus) { this->i2c_bus_ = bus; }
+  void set_hardware_fades(bool enabled) { this->hardware_fades_ = enabled; }
+#ifdef USE_I2C_ARBITER
+  void set_i2c_arbiter(i2c_arbiter::I2CArbiter *arbiter) { this->arbiter_ = arbiter; }
+#endif
   void set_default_service(const std::string &service) { this->default_service_ = service; }
   void set_preset_text_sensor(text_sensor::TextSensor *sensor) { this->preset_text_sensor_ = sensor; }
   void set_preset_target_sensor(text_sensor::TextSensor *sensor) { this->preset_target_sensor_ = sensor; }
@@ -75,6 +82,14 @@ class RadioController : public Component {
   void add_preset(uint8_t row, uint8_t column, const std::string &display_text, const std::string &target, const std::string &service);
   void add_preset_data(uint8_t row, uint8_t column, const std::string &key, const std::string &value);
   void set_encoder_button(uint8_t row, uint8_t column);
+  // Encoder acceleration curve point (step ENCODER_STEP_GROUP jumps an alphabetical group)
+  void add_encoder_acceleration(uint32_t below_ms, uint16_t step) { this->encoder_acceleration_.add_point(below_ms, step); }
+  // While spinning: draw the landing item once no detent came for settle_ms,
+  // and in between at most every redraw_interval_ms (0 = only the landing item)
+  void set_spin_redraw(uint32_t settle_ms, uint32_t redraw_interval_ms) {
+    this->spin_settle_ms_ = settle_ms;
+    this->spin_redraw_interval_ms_ = redraw_interval_ms;
+  }
   
   // Get preset by index for select
   std::vector<std::string> get_preset_names() const;
@@ -95,6 +110,19 @@ class RadioController : public Component {
   // All favorites browsing (unified radio + playlists)
   void load_all_favorites(const std::string &json_data);
   
+  // Favorites paging: only a window of the list is kept, and pages are
+  // requested from HA with `event` as browsing nears a window edge
+  void set_favorites_paging(const std::string &event, uint16_t page_size, uint8_t window_pages, uint16_t prefetch) {
+    this->favorites_page_event_ = event;
+    this->favorites_page_size_ = page_size;
+    this->favorites_.set_max_size(page_size * window_pages);
+    this->favorites_prefetch_ = prefetch;
+  }
+  // Favorites from `offset` on (the answer to a page request for `limit`,
+  // which HA echoes); radios is the number of radios ahead of the
+  // playlists, or -1 if HA doesn't know yet
+  void load_favorites_page(int32_t offset, int32_t limit, int32_t radios, const std::string &json_data);
+  
   // Preset storage management
   void save_preset_to_slot(uint8_t slot, const std::string &media_id, const std::string &display_name);
   StoredPreset get_preset(uint8_t slot);
@@ -118,21 +146,34 @@ class RadioController : public Component {
  protected:
   // New browse management methods
   void build_browse_list_();
+  // Preset slot from stored_presets_/presets_, in place
+  void update_browse_preset_(uint8_t slot);
+  // Playlists or favorites segment from its source list; selections follow their IDs
+  void replace_browse_segment_(BrowseItem::Type type);
+  void fill_browse_preset_(BrowseItem &item, uint8_t slot);
   void enter_browse_mode_();
   void exit_browse_mode_();
-  void scroll_browse_(int direction);
+  void scroll_browse_(int delta);
+  void jump_browse_group_(int direction);
+  // Encoder turned with the button held: first favorite of the next/previous letter
+  void jump_browse_letter_(int direction);
+  char browse_initial_(size_t index) const;
+  void show_browse_item_();
+  void update_browse_spin_();
   void select_current_browse_item_();
   void play_browse_item_(size_t index);
   void toggle_play_stop_();
   void update_leds_for_browse_();
   
+  void process_key_events_();
   void handle_key_press_(uint8_t row, uint8_t column);
   void handle_key_release_(uint8_t row, uint8_t column);
-  void process_encoder_rotation_();
+  void process_encoder_rotation_(bool is_a, bool level);
   Preset* find_preset_(uint8_t row, uint8_t column);
   Preset* find_preset_by_name_(const std::string &name);
   void activate_preset_(Preset *preset);
   void call_home_assistant_service_(const std::string &service, const std::map<std::string, std::string> &data);
+  void fire_home_assistant_event_(const std::string &event, const std::map<std::string, std::string> &data);
   
   // Panel LED helpers
   bool init_panel_leds_();
@@ -141,11 +182,19 @@ class RadioController : public Component {
   void update_mode_selector_led_(uint8_t mode);
   void set_vu_meter_target_brightness(uint8_t target);
   void update_vu_meter_slew_();
+  bool start_vu_meter_fade_in_(uint8_t target);
+  void finish_vu_meter_fade_();
+  void update_memory_led_pulse_();
+  void flush_panel_leds_();
   
   // Display formatting with playback icons
   std::string format_display_text_(const std::string &text, bool show_icon = true);
   
   tca8418_keypad::TCA8418Component *keypad_{nullptr};
+  tca8418_keypad::KeyEventQueue key_events_;  // Filled by the keypad as it reads the chip
+  uint32_t key_event_us_{0};                  // Read time of the event being handled
+  uint32_t key_events_handled_{0};
+  uint32_t key_latency_max_us_{0};            // Longest wait from chip read to handling
   retrotext_display::RetroTextDisplay *display_{nullptr};
   i2c::I2CBus *i2c_bus_{nullptr};
   text_sensor::TextSensor *preset_text_sensor_{nullptr};
@@ -159,25 +208,41 @@ class RadioController : public Component {
   std::string current_preset_name_;
   uint8_t current_preset_index_{255};  // 255 = none
   
-  // Playlist data (used to build browse list)
-  struct PlaylistItem {
-    std::string name;
-    std::string uri;
-  };
+  // Playlist data (used to build browse list); browse items share the strings
   std::vector<PlaylistItem> playlists_;
   size_t playlist_index_{0};
+  // Streams [{"name": ..., "uri": ...}, ...] into items; false on malformed JSON
+  bool parse_favorites_(const std::string &json_data, std::vector<PlaylistItem> &items, const char *what);
+  void release_items_(std::vector<PlaylistItem> &items);
+  
+  // Names and URIs of everything in the browse list and its sources
+  StringArena strings_;
+  const char *text_(ArenaString string) const { return this->strings_.c_str(string); }
+  void compact_strings_();
+  void dump_browse_memory_();
   
   // Panel LEDs (internal, automatic)
   std::unique_ptr<esphome::retrotext_display::IS31FL3737Driver> led_driver_;
   bool panel_leds_initialized_{false};
+#ifdef USE_I2C_ARBITER
+  i2c_arbiter::I2CArbiter *arbiter_{nullptr};  // Panel LED pushes as bulk jobs
+#endif
+  
+  // Chip auto breath (ABM) for fades and pulses; software animation otherwise
+  bool hardware_fades_{true};
+  bool memory_led_pulsing_{false};  // Memory LED on ABM-2 (save preset mode)
   
   // VU meter backlight slew
   uint8_t vu_meter_current_brightness_{0};
   uint8_t vu_meter_target_brightness_{0};
   uint32_t last_vu_meter_update_{0};
+  bool vu_meter_fading_{false};     // Backlights on ABM-1 fading in from off
+  uint32_t vu_meter_fade_start_{0};
+  uint32_t vu_meter_fade_duration_{0};
   
   // VU meter test mode
   bool vu_meter_test_active_{false};
+  bool vu_meter_test_breathing_{false};  // Meters on ABM-1/2/3 instead of the software sweep
   uint32_t vu_meter_test_start_{0};
   uint32_t vu_meter_test_phase_{0};
   
@@ -186,13 +251,21 @@ class RadioController : public Component {
   uint8_t encoder_row_{0};
   uint8_t encoder_column_{0};
   
-  // Encoder rotation tracking (full quadrature with detent tracking)
-  bool encoder_a_state_{false};
-  bool encoder_b_state_{false};
-  uint8_t encoder_last_encoded_{0};
-  int8_t encoder_detent_count_{0};   // Steps within current detent (0-2 for this hardware)
-  int32_t encoder_count_{0};         // Completed detents count
-  int32_t last_encoder_count_{0};    // Last processed count
+  // Encoder rotation (2 quadrature steps per detent for this hardware)
+  QuadratureDecoder encoder_decoder_{2};
+  EncoderAcceleration encoder_acceleration_;
+  uint32_t spin_settle_ms_{150};
+  uint32_t spin_redraw_interval_ms_{300};
+  uint32_t last_detent_ms_{0};
+  uint32_t last_browse_draw_ms_{0};
+  bool browse_redraw_pending_{false};     // Selection moved during a spin, not drawn yet
+  uint32_t browse_redraws_skipped_{0};
+  uint32_t encoder_group_jumps_{0};
+  // Encoder button held while turning jumps by letter; a plain press toggles play/stop on release
+  bool encoder_button_held_{false};
+  bool encoder_button_turned_{false};
+  uint32_t encoder_letter_jumps_{0};
+  int8_t letter_jump_pending_{0};           // Jump direction waiting for the next favorites page (0 = none)
   
   // Unified browse state
   std::vector<BrowseItem> browse_items_;      // Unified list of presets + playlists + all favorites
@@ -211,7 +284,22 @@ class RadioController : public Component {
   // Note: Individual preset sensors removed - use select component instead
   
   // All favorites cache (for browse mode)
-  std::vector<PlaylistItem> all_favorites_;   // Combined radios + playlists from MA
+  FavoritesWindow favorites_;                 // Combined radios + playlists from MA
+  LetterIndex favorites_letters_;             // Initial -> position in the favorites segment
+  
+  // Favorites paging (off while the event is empty): favorites_ holds a
+  // window of the full list
+  std::string favorites_page_event_;
+  uint16_t favorites_page_size_{25};
+  uint16_t favorites_prefetch_{8};            // Items from a window edge that trigger the next page
+  int32_t favorites_radios_{-1};              // Passed back to HA once known
+  int32_t favorites_request_offset_{-1};      // Page in flight (-1 = none)
+  uint32_t favorites_request_ms_{0};
+  uint32_t favorites_pages_loaded_{0};
+  bool favorites_more_after_() const;
+  bool favorites_more_before_() const;
+  void prefetch_favorites_();
+  void request_favorites_page_(uint32_t offset, uint16_t limit);
   
   // Memory button (for save preset mode)
   bool has_memory_button_{false};
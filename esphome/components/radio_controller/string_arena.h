@@ -0,0 +1,109 @@
+/**
+ * Append-only string arena
+ *
+ * Names and URIs for the browse list live back to back in one buffer, each
+ * with a terminating NUL so it can go straight to the display or the log.
+ * Holders keep an ArenaString (offset + length, 8 bytes) instead of a
+ * std::string, so a favorite costs its text once however many lists refer
+ * to it, and hundreds of entries are one allocation instead of hundreds.
+ *
+ * Nothing is freed in place: release() only counts a string as garbage, and
+ * compact() copies the strings still in use into fresh storage once enough
+ * has piled up (the caller enumerates them, updating each ArenaString).
+ * Offsets stay valid until then; pointers from c_str() only until the next
+ * add().
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace radio_controller {
+
+// Longest string kept (longer ones are cut)
+constexpr size_t ARENA_STRING_MAX = UINT16_MAX;
+
+struct ArenaString {
+  uint32_t offset{0};
+  uint16_t length{0};
+  bool empty() const { return this->length == 0; }
+};
+
+class StringArena {
+ public:
+  ArenaString add(const char *text, size_t length) {
+    ArenaString string;
+    if (length == 0) {
+      return string;  // Empty strings take no space
+    }
+    if (length > ARENA_STRING_MAX) {
+      length = ARENA_STRING_MAX;
+    }
+    string.offset = this->data_.size();
+    string.length = length;
+    this->data_.insert(this->data_.end(), text, text + length);
+    this->data_.push_back('\0');
+    return string;
+  }
+  ArenaString add(const char *text) { return this->add(text, strlen(text)); }
+  ArenaString add(const std::string &text) { return this->add(text.data(), text.size()); }
+
+  const char *c_str(ArenaString string) const {
+    return string.length == 0 ? "" : this->data_.data() + string.offset;
+  }
+  std::string str(ArenaString string) const { return std::string(this->c_str(string), string.length); }
+  bool equals(ArenaString string, const char *text, size_t length) const {
+    return string.length == length && memcmp(this->c_str(string), text, length) == 0;
+  }
+  bool equals(ArenaString string, const std::string &text) const {
+    return this->equals(string, text.data(), text.size());
+  }
+
+  // The string is no longer referenced anywhere
+  void release(ArenaString string) {
+    if (string.length != 0) {
+      this->garbage_ += string.length + 1;
+    }
+  }
+
+  // Copies the strings still in use to fresh storage and drops the rest.
+  // for_each_live(visit) must call visit(ArenaString &) once for every
+  // string still referenced; each one is updated to its new offset
+  template<typename ForEach> void compact(ForEach for_each_live) {
+    std::vector<char> data;
+    data.reserve(this->get_live());
+    for_each_live([this, &data](ArenaString &string) {
+      if (string.length == 0) {
+        return;
+      }
+      const char *text = this->c_str(string);
+      string.offset = data.size();
+      data.insert(data.end(), text, text + string.length + 1);
+    });
+    this->data_.swap(data);
+    this->garbage_ = 0;
+  }
+
+  void clear() {
+    this->data_.clear();
+    this->garbage_ = 0;
+  }
+  void reserve(size_t bytes) { this->data_.reserve(bytes); }
+
+  // Bytes used (live + garbage), allocated, and released but not yet reclaimed
+  size_t get_size() const { return this->data_.size(); }
+  size_t get_capacity() const { return this->data_.capacity(); }
+  size_t get_garbage() const { return this->garbage_; }
+  size_t get_live() const { return this->data_.size() - this->garbage_; }
+
+ protected:
+  std::vector<char> data_;
+  size_t garbage_{0};
+};
+
+}  // namespace radio_controller
+}  // namespace esphome
@@ -4,7 +4,7 @@ Displays text on a 3-board IS31FL3737 LED matrix display (72×6 pixels, 18 chara
 """
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import i2c
+from esphome.components import i2c, i2c_arbiter
 from esphome.const import CONF_ID
 
 DEPENDENCIES = ["i2c"]
@@ -19,6 +19,9 @@ CONF_BOARDS = "boards"
 CONF_ADDRESS = "address"
 CONF_SCROLL_DELAY = "scroll_delay"
 CONF_SCROLL_MODE = "scroll_mode"
+CONF_SMOOTH_SCROLL = "smooth_scroll"
+CONF_SHIMMER_FPS = "shimmer_fps"
+CONF_PUSH_BUDGET = "push_budget"
 
 CONFIG_SCHEMA = cv.Schema(
     {
@@ -33,6 +36,12 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_SCROLL_MODE, default="auto"): cv.enum(
             {"auto": 0, "always": 1, "never": 2}, upper=False
         ),
+        cv.Optional(CONF_SMOOTH_SCROLL, default=False): cv.boolean,
+        cv.Optional(CONF_SHIMMER_FPS, default=30): cv.int_range(min=1, max=60),
+        # I2C time per loop for pushing a frame; 0 pushes whole frames at once
+        cv.Optional(CONF_PUSH_BUDGET, default="2ms"): cv.positive_time_period_microseconds,
+        # Frames go out as arbiter bulk jobs (push_budget is then unused)
+        cv.Optional(i2c_arbiter.CONF_I2C_ARBITER_ID): cv.use_id(i2c_arbiter.I2CArbiter),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -55,3 +64,7 @@ async def to_code(config):
     # Set scroll configuration
     cg.add(var.set_scroll_delay(config[CONF_SCROLL_DELAY]))
     cg.add(var.set_scroll_mode(config[CONF_SCROLL_MODE]))
+    cg.add(var.set_smooth_scroll(config[CONF_SMOOTH_SCROLL]))
+    cg.add(var.set_shimmer_fps(config[CONF_SHIMMER_FPS]))
+    cg.add(var.set_push_budget(config[CONF_PUSH_BUDGET]))
+    await i2c_arbiter.register_arbiter_client(var, config)
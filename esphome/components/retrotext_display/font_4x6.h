@@ -8,13 +8,14 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace esphome {
 namespace retrotext_display {
 
-// Font stored in flash (const)
-static const uint8_t modern_font4x6[] = {
+// Font stored in flash (constexpr so glyph_cache.h can convert it at compile time)
+static constexpr uint8_t modern_font4x6[] = {
 4,6,32,
 // 32 - [ ] (not available)
 0b00000000,
@@ -824,7 +825,6 @@ static const uint8_t modern_font4x6[] = {
 0b10000000,
 0b10010000,
 0b01100000,
-0b01000000,  // Note: 7 rows for descender
 // 147 - [ÿ] - y with dots
 0b01010000,
 0b10010000,
@@ -1095,6 +1095,14 @@ inline uint8_t map_utf8_to_glyph(const char* str, size_t& bytes_consumed) {
     }
   }
   
+  // 4-byte UTF-8 sequence (emoji etc.) - no glyphs, but skip the whole sequence so
+  // its continuation bytes are not drawn as extended glyphs 128-159
+  if ((c & 0xF8) == 0xF0) {
+    while (bytes_consumed < 4 && ((uint8_t)str[bytes_consumed] & 0xC0) == 0x80) {
+      bytes_consumed++;
+    }
+  }
+  
   // Unsupported character - return space
   return ' ';
 }
@@ -0,0 +1,63 @@
+/**
+ * Column glyph cache for the 4×6 font
+ *
+ * modern_font4x6 stores each glyph as 6 row bytes (bits 7-4, mirrored on this
+ * display). This converts it at compile time into 4 column bytes per glyph,
+ * left to right with the mirroring already applied: bit N of a column byte is
+ * row N (0 = top). Drawing a character is then a copy of 4 bytes into the
+ * column-major framebuffer.
+ */
+#pragma once
+
+#include "font_4x6.h"
+#include <cstdint>
+
+namespace esphome {
+namespace retrotext_display {
+
+constexpr uint8_t GLYPH_WIDTH = 4;
+constexpr uint8_t GLYPH_HEIGHT = 6;
+constexpr uint8_t FONT_FIRST_GLYPH = 32;  // Space
+constexpr uint8_t FONT_LAST_GLYPH = 159;  // End of extended range (128-159)
+constexpr uint16_t FONT_GLYPH_COUNT = FONT_LAST_GLYPH - FONT_FIRST_GLYPH + 1;
+constexpr uint16_t FONT_HEADER_SIZE = 3;  // width, height, first char
+
+static_assert(sizeof(modern_font4x6) == FONT_HEADER_SIZE + FONT_GLYPH_COUNT * GLYPH_HEIGHT,
+              "font_4x6.h must hold 6 rows for each glyph 32-159");
+
+struct GlyphColumnCache {
+  uint8_t columns[FONT_GLYPH_COUNT + 1][GLYPH_WIDTH];  // Last entry is blank
+};
+
+constexpr GlyphColumnCache build_glyph_column_cache() {
+  GlyphColumnCache cache{};
+  for (uint16_t glyph = 0; glyph < FONT_GLYPH_COUNT; glyph++) {
+    // 127 (DEL) has data in the font but was never drawn; keep it blank
+    if (glyph + FONT_FIRST_GLYPH == 127) {
+      continue;
+    }
+    for (uint8_t row = 0; row < GLYPH_HEIGHT; row++) {
+      uint8_t bits = modern_font4x6[FONT_HEADER_SIZE + glyph * GLYPH_HEIGHT + row];
+      for (uint8_t col = 0; col < GLYPH_WIDTH; col++) {
+        // Font bit 7 is the leftmost pixel on screen (bit reversal, see DisplayManager.cpp)
+        if (bits & (0x80 >> col)) {
+          cache.columns[glyph][col] |= 1 << row;
+        }
+      }
+    }
+  }
+  return cache;
+}
+
+static constexpr GlyphColumnCache GLYPH_COLUMNS = build_glyph_column_cache();
+
+// Column bytes for a glyph index from map_utf8_to_glyph(); unsupported glyphs are blank
+inline const uint8_t *glyph_columns(uint8_t glyph) {
+  if (glyph < FONT_FIRST_GLYPH || glyph > FONT_LAST_GLYPH) {
+    return GLYPH_COLUMNS.columns[FONT_GLYPH_COUNT];
+  }
+  return GLYPH_COLUMNS.columns[glyph - FONT_FIRST_GLYPH];
+}
+
+}  // namespace retrotext_display
+}  // namespace esphome
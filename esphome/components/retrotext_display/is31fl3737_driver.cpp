@@ -52,11 +52,22 @@ bool IS31FL3737Driver::begin(uint8_t address, i2c::I2CBus *bus) {
 }
 
 void IS31FL3737Driver::reset() {
+  // Registers return to defaults, so the PWM shadow no longer matches the chip
+  this->shadow_valid_ = false;
+  this->push_pending_ = false;
+  
   // Software reset by reading from reset register
   this->select_page_(IS31FL3737_PAGE_FUNCTION);
   uint8_t dummy;
   this->read_register_(IS31FL3737_REG_RESET, &dummy);
   delay_microseconds_safe(10000);  // Wait 10ms for reset to complete
+  
+  // Don't assume which page the chip is on after a reset
+  this->current_page_ = IS31FL3737_PAGE_UNKNOWN;
+  
+  // All LEDs are back in PWM mode with breathing disabled
+  this->led_modes_.fill(IS31FL3737_LED_MODE_PWM);
+  this->config_ = IS31FL3737_CONFIG_SSD;
 }
 
 bool IS31FL3737Driver::enable_all_leds_() {
@@ -85,7 +96,7 @@ bool IS31FL3737Driver::configure_function_page_() {
   }
   
   // Configuration register: SSD=1 (Normal Operation)
-  if (!this->write_register_(IS31FL3737_REG_CONFIG, IS31FL3737_CONFIG_SSD)) {
+  if (!this->write_register_(IS31FL3737_REG_CONFIG, this->config_)) {
     return false;
   }
   
@@ -98,54 +109,137 @@ bool IS31FL3737Driver::configure_function_page_() {
 }
 
 void IS31FL3737Driver::show() {
+  this->start_show();
+  while (!this->show_step()) {
+  }
+}
+
+void IS31FL3737Driver::request_show() {
+  this->stats_.show_requests++;
+  this->show_requested_ = true;
+}
+
+bool IS31FL3737Driver::flush() {
+  if (!this->start_flush()) {
+    return false;
+  }
+  while (!this->show_step()) {
+  }
+  return true;
+}
+
+bool IS31FL3737Driver::start_flush() {
+  if (!this->show_requested_) {
+    return false;
+  }
+  this->show_requested_ = false;
+  this->stats_.flushes++;
+  this->start_show();
+  return true;
+}
+
+void IS31FL3737Driver::start_show() {
   if (!this->initialized_ || this->bus_ == nullptr) {
     return;
   }
   
-  // Switch to PWM page
-  this->select_page_(IS31FL3737_PAGE_PWM);
+  this->stats_.frames++;
+  this->push_pending_ = true;
+  this->push_position_ = 0;
+  this->push_page_selected_ = false;
+  this->push_ok_ = true;
+  // Without a trusted shadow (first frame, after reset or a failed write), push everything
+  this->push_full_ = !this->shadow_valid_;
+}
+
+bool IS31FL3737Driver::show_step() {
+  if (!this->push_pending_) {
+    return true;
+  }
+  
+  uint16_t run_start = 0;
+  uint16_t run_end = 0;
+  if (this->push_full_) {
+    run_start = this->push_position_;
+    run_end = run_start + IS31FL3737_CHUNK_SIZE;
+  } else if (!this->find_changed_run_(this->push_position_, run_start, run_end)) {
+    if (!this->push_page_selected_) {
+      this->stats_.frames_unchanged++;
+    }
+    this->push_pending_ = false;
+    return true;
+  }
+  
+  // Breath or current changes between steps may have moved the chip off the PWM page
+  if (!this->push_page_selected_ || this->current_page_ != IS31FL3737_PAGE_PWM) {
+    this->select_page_(IS31FL3737_PAGE_PWM);
+    this->push_page_selected_ = true;
+  }
   
-  // Build hardware register buffer (192 bytes for IS31FL3737)
-  // IS31FL3737 PWM registers: 12 rows × 16-byte stride = 192 bytes (0x00-0xBF)
-  constexpr uint16_t HW_REGISTER_SIZE = IS31FL3737_MATRIX_HEIGHT * IS31FL3737_REGISTER_STRIDE;
-  uint8_t hw_buffer[HW_REGISTER_SIZE];
-  memset(hw_buffer, 0, sizeof(hw_buffer));
+  this->push_ok_ &= this->write_pwm_run_(run_start, run_end - run_start);
+  this->push_position_ = run_end;
   
-  // Map logical buffer to hardware register layout
-  for (uint8_t y = 0; y < IS31FL3737_MATRIX_HEIGHT; y++) {
-    for (uint8_t x = 0; x < IS31FL3737_MATRIX_WIDTH; x++) {
-      uint16_t buffer_index = y * IS31FL3737_MATRIX_WIDTH + x;
-      uint16_t reg_address = this->coord_to_register_(x, y);
-      hw_buffer[reg_address] = this->pwm_buffer_[buffer_index];
+  if (this->push_full_) {
+    if (this->push_position_ < IS31FL3737_PWM_REGISTER_SIZE) {
+      return false;
     }
+    this->shadow_valid_ = this->push_ok_;
+  } else if (!this->push_ok_) {
+    // Chip state is unknown now - resend the whole image next frame
+    this->shadow_valid_ = false;
+  } else if (this->find_changed_run_(this->push_position_, run_start, run_end)) {
+    return false;
   }
   
-  // Write PWM buffer in safe chunks using I2C burst writes with auto-increment
-  // ESP32 I2C buffer is typically 128 bytes, so use 64-byte data chunks (+ 1 byte for register address)
-  constexpr uint8_t CHUNK_SIZE = 64;
-  uint16_t bytes_remaining = HW_REGISTER_SIZE;
-  uint16_t bytes_written = 0;
+  this->push_pending_ = false;
+  return true;
+}
+
+bool IS31FL3737Driver::find_changed_run_(uint16_t from, uint16_t &run_start, uint16_t &run_end) const {
+  // Next run of registers that differ from what the chip already holds.
+  // Nearby runs are merged (see IS31FL3737_MERGE_GAP) and long runs split into chunks.
+  uint16_t reg = from;
+  while (reg < IS31FL3737_PWM_REGISTER_SIZE && this->pwm_registers_[reg] == this->shadow_[reg]) {
+    reg++;
+  }
+  if (reg >= IS31FL3737_PWM_REGISTER_SIZE) {
+    return false;
+  }
+  
+  run_start = reg;
+  run_end = reg + 1;  // Exclusive
+  uint16_t scan = run_end;
+  while (scan < IS31FL3737_PWM_REGISTER_SIZE && scan - run_start < IS31FL3737_CHUNK_SIZE) {
+    if (this->pwm_registers_[scan] != this->shadow_[scan]) {
+      run_end = scan + 1;
+    } else if (scan - run_end >= IS31FL3737_MERGE_GAP) {
+      break;
+    }
+    scan++;
+  }
+  return true;
+}
+
+bool IS31FL3737Driver::write_pwm_run_(uint8_t start, uint8_t length) {
+  // Write one run using I2C burst mode (auto-increment)
+  // First byte is the starting register address
+  uint8_t chunk_buffer[IS31FL3737_CHUNK_SIZE + 1];
+  chunk_buffer[0] = start;
+  memcpy(&chunk_buffer[1], &this->pwm_registers_[start], length);
+  
+  this->stats_.transactions++;
+  this->stats_.bytes_written += length;
   
-  while (bytes_remaining > 0) {
-    uint8_t bytes_to_write = (bytes_remaining > CHUNK_SIZE) ? CHUNK_SIZE : bytes_remaining;
-    uint8_t chunk_buffer[CHUNK_SIZE + 1];
-    
-    // First byte is the starting register address
-    chunk_buffer[0] = bytes_written;
-    
-    // Copy chunk data
-    memcpy(&chunk_buffer[1], &hw_buffer[bytes_written], bytes_to_write);
-    
-    // Write chunk using I2C burst mode (auto-increment)
-    this->bus_->write(this->address_, chunk_buffer, bytes_to_write + 1);
-    
-    bytes_written += bytes_to_write;
-    bytes_remaining -= bytes_to_write;
+  if (!this->bus_write_(chunk_buffer, length + 1)) {
+    return false;
   }
+  
+  memcpy(&this->shadow_[start], &this->pwm_registers_[start], length);
+  return true;
 }
 
 void IS31FL3737Driver::clear() {
-  this->pwm_buffer_.fill(0);
+  this->pwm_registers_.fill(0);
 }
 
 void IS31FL3737Driver::set_pixel(uint8_t x, uint8_t y, uint8_t brightness) {
@@ -154,8 +248,7 @@ void IS31FL3737Driver::set_pixel(uint8_t x, uint8_t y, uint8_t brightness) {
     return;
   }
   
-  uint16_t index = y * IS31FL3737_MATRIX_WIDTH + x;
-  this->pwm_buffer_[index] = brightness;
+  this->pwm_registers_[is31fl3737_pwm_register(x, y)] = brightness;
 }
 
 uint8_t IS31FL3737Driver::get_pixel(uint8_t x, uint8_t y) const {
@@ -164,35 +257,100 @@ uint8_t IS31FL3737Driver::get_pixel(uint8_t x, uint8_t y) const {
     return 0;
   }
   
-  uint16_t index = y * IS31FL3737_MATRIX_WIDTH + x;
-  return this->pwm_buffer_[index];
+  return this->pwm_registers_[is31fl3737_pwm_register(x, y)];
 }
 
 void IS31FL3737Driver::set_global_current(uint8_t current) {
   this->global_current_ = current;
   
   if (this->initialized_) {
-    // Update hardware
+    // Update hardware. No switch back to the PWM page: the next show() selects it
+    // only if it has something to send.
     this->select_page_(IS31FL3737_PAGE_FUNCTION);
     this->write_register_(IS31FL3737_REG_GLOBAL_CURRENT, current);
-    this->select_page_(IS31FL3737_PAGE_PWM);  // Switch back to PWM page
   }
 }
 
+bool IS31FL3737Driver::set_breath(uint8_t abm, const IS31FL3737Breath &breath) {
+  if (!this->initialized_ || abm < 1 || abm > IS31FL3737_ABM_COUNT) {
+    return false;
+  }
+  
+  // Control registers 1-4 in one burst: T1|T2, T3|T4, LE|LB|loops high, loops low
+  uint8_t buffer[5];
+  buffer[0] = IS31FL3737_REG_ABM1 + (abm - 1) * 4;
+  buffer[1] = (breath.rise & 0x07) << 5 | (breath.hold & 0x0F) << 1;
+  buffer[2] = (breath.fall & 0x07) << 5 | (breath.off & 0x0F) << 1;
+  buffer[3] = (breath.end_on ? 0x10 : 0x00) | (breath.loop_begin & 0x03) << 2 | ((breath.loops >> 8) & 0x03);
+  buffer[4] = breath.loops & 0xFF;
+  
+  return this->select_page_(IS31FL3737_PAGE_FUNCTION) && this->bus_write_(buffer, sizeof(buffer));
+}
+
+bool IS31FL3737Driver::set_led_mode(uint8_t x, uint8_t y, uint8_t mode) {
+  if (!this->initialized_ || x >= IS31FL3737_MATRIX_WIDTH || y >= IS31FL3737_MATRIX_HEIGHT ||
+      mode > IS31FL3737_ABM_COUNT) {
+    return false;
+  }
+  
+  uint8_t reg = is31fl3737_pwm_register(x, y);
+  if (this->led_modes_[reg] == mode) {
+    return true;
+  }
+  if (!this->select_page_(IS31FL3737_PAGE_ABM) || !this->write_register_(reg, mode)) {
+    return false;
+  }
+  this->led_modes_[reg] = mode;
+  return true;
+}
+
+uint8_t IS31FL3737Driver::get_led_mode(uint8_t x, uint8_t y) const {
+  if (x >= IS31FL3737_MATRIX_WIDTH || y >= IS31FL3737_MATRIX_HEIGHT) {
+    return IS31FL3737_LED_MODE_PWM;
+  }
+  return this->led_modes_[is31fl3737_pwm_register(x, y)];
+}
+
+bool IS31FL3737Driver::start_breath() {
+  if (!this->initialized_ || !this->select_page_(IS31FL3737_PAGE_FUNCTION)) {
+    return false;
+  }
+  
+  // B_EN stays on once used: LEDs in PWM mode are unaffected by it
+  if (!(this->config_ & IS31FL3737_CONFIG_B_EN)) {
+    if (!this->write_register_(IS31FL3737_REG_CONFIG, this->config_ | IS31FL3737_CONFIG_B_EN)) {
+      return false;
+    }
+    this->config_ |= IS31FL3737_CONFIG_B_EN;
+  }
+  return this->write_register_(IS31FL3737_REG_TIME_UPDATE, 0x00);
+}
+
 bool IS31FL3737Driver::select_page_(uint8_t page) {
   if (this->bus_ == nullptr) {
     return false;
   }
   
+  // The page register keeps its value, so reselecting the current page is a no-op
+  if (page == this->current_page_) {
+    this->stats_.page_selects_skipped++;
+    return true;
+  }
+  this->stats_.page_selects++;
+  
   // Unlock command register
   uint8_t unlock_buffer[2] = {IS31FL3737_REG_UNLOCK, IS31FL3737_UNLOCK_VALUE};
-  if (this->bus_->write(this->address_, unlock_buffer, 2) != i2c::ERROR_OK) {
+  if (!this->bus_write_(unlock_buffer, 2)) {
     return false;
   }
   
   // Select page
   uint8_t page_buffer[2] = {IS31FL3737_REG_COMMAND, page};
-  return this->bus_->write(this->address_, page_buffer, 2) == i2c::ERROR_OK;
+  if (!this->bus_write_(page_buffer, 2)) {
+    return false;
+  }
+  this->current_page_ = page;
+  return true;
 }
 
 bool IS31FL3737Driver::write_register_(uint8_t reg, uint8_t value) {
@@ -201,7 +359,7 @@ bool IS31FL3737Driver::write_register_(uint8_t reg, uint8_t value) {
   }
   
   uint8_t buffer[2] = {reg, value};
-  return this->bus_->write(this->address_, buffer, 2) == i2c::ERROR_OK;
+  return this->bus_write_(buffer, 2);
 }
 
 bool IS31FL3737Driver::read_register_(uint8_t reg, uint8_t *value) {
@@ -210,27 +368,26 @@ bool IS31FL3737Driver::read_register_(uint8_t reg, uint8_t *value) {
   }
   
   // Write register address
-  if (this->bus_->write(this->address_, &reg, 1) != i2c::ERROR_OK) {
+  if (!this->bus_write_(&reg, 1)) {
     return false;
   }
   
   // Read value
-  return this->bus_->read(this->address_, value, 1) == i2c::ERROR_OK;
+  if (this->bus_->read(this->address_, value, 1) != i2c::ERROR_OK) {
+    this->current_page_ = IS31FL3737_PAGE_UNKNOWN;
+    return false;
+  }
+  return true;
 }
 
-uint16_t IS31FL3737Driver::coord_to_register_(uint8_t x, uint8_t y) const {
-  // Convert 0-based coordinates to 1-based CS/SW
-  uint8_t cs = x + 1;  // CSx (1-12)
-  uint8_t sw = y + 1;  // SWy (1-12)
-  
-  // IS31FL3737 hardware quirk: CS7-CS12 (1-based) are remapped to CS9-CS14 in register space
-  // This is documented in the IS31FL373x driver library (line 365-368)
-  if (cs >= 7 && cs <= 12) {
-    cs = cs + 2;  // CS7→CS9, CS8→CS10, ..., CS12→CS14
+bool IS31FL3737Driver::bus_write_(const uint8_t *data, size_t len) {
+  this->stats_.bus_writes++;
+  if (this->bus_->write(this->address_, data, len) != i2c::ERROR_OK) {
+    // A failed transfer may have left the chip anywhere: reselect the page next time
+    this->current_page_ = IS31FL3737_PAGE_UNKNOWN;
+    return false;
   }
-  
-  // IS31FL3737 register mapping: Address = (SWy - 1) * stride + (CSx - 1)
-  return static_cast<uint16_t>((sw - 1) * IS31FL3737_REGISTER_STRIDE + (cs - 1));
+  return true;
 }
 
 }  // namespace retrotext_display
@@ -17,6 +17,87 @@
 namespace esphome {
 namespace retrotext_display {
 
+// Burst writes are split at this size (ESP32 I2C buffer is typically 128 bytes)
+constexpr uint8_t IS31FL3737_CHUNK_SIZE = 64;
+
+// current_page_ value when the chip's page register state is not known
+constexpr uint8_t IS31FL3737_PAGE_UNKNOWN = 0xFF;
+
+// Changed runs separated by this many unchanged bytes or fewer are sent as one
+// write: resending a short gap is cheaper than another address + register byte,
+// start/stop and I2C driver setup
+constexpr uint8_t IS31FL3737_MERGE_GAP = 8;
+
+/**
+ * Bus traffic counters
+ *
+ * "Full" figures are what the previous whole-image push would have cost:
+ * 192 bytes in three 64-byte transactions per frame.
+ */
+struct IS31FL3737Stats {
+  uint32_t frames{0};            // show() calls
+  uint32_t frames_unchanged{0};  // show() calls with nothing to send
+  uint32_t bytes_written{0};     // PWM bytes sent (excluding register address bytes)
+  uint32_t transactions{0};      // PWM burst writes issued
+  uint32_t bus_writes{0};        // All I2C writes to the chip (page selects, registers, PWM)
+  uint32_t page_selects{0};      // Unlock + page select sequences sent (2 writes each)
+  uint32_t page_selects_skipped{0};  // Selects of the page the chip was already on
+  uint32_t show_requests{0};     // request_show() calls
+  uint32_t flushes{0};           // flush() calls that pushed a frame
+
+  uint32_t full_bytes() const { return this->frames * IS31FL3737_PWM_REGISTER_SIZE; }
+  uint32_t full_transactions() const {
+    return this->frames * ((IS31FL3737_PWM_REGISTER_SIZE + IS31FL3737_CHUNK_SIZE - 1) / IS31FL3737_CHUNK_SIZE);
+  }
+  int32_t bytes_saved() const { return (int32_t) this->full_bytes() - (int32_t) this->bytes_written; }
+  int32_t transactions_saved() const { return (int32_t) this->full_transactions() - (int32_t) this->transactions; }
+  // Pushes a show() per request would have cost on top of the flushes
+  uint32_t flushes_avoided() const { return this->show_requests - this->flushes; }
+};
+
+/**
+ * Auto breath (ABM) waveform, in datasheet timing codes
+ *
+ * Each cycle: rise 0 → PWM value (T1), hold (T2), fall to 0 (T3), off (T4).
+ * The first cycle starts at T1, later ones at loop_begin. After `loops`
+ * cycles the LED stops at the end of T1 (end_on, stays at its PWM value)
+ * or T3 (off). The PWM register sets the peak brightness.
+ */
+struct IS31FL3737Breath {
+  uint8_t rise{0};        // T1 code (is31fl3737_abm_ramp_code)
+  uint8_t hold{0};        // T2 code (is31fl3737_abm_hold_code)
+  uint8_t fall{0};        // T3 code
+  uint8_t off{0};         // T4 code (up to IS31FL3737_ABM_OFF_MAX_CODE)
+  uint8_t loop_begin{0};  // 0 = T1, 1 = T2, 2 = T3, 3 = T4
+  bool end_on{false};
+  uint16_t loops{0};      // 0 = endless
+
+  // One-shot fade up to the PWM value, then hold it
+  static IS31FL3737Breath fade_in(uint32_t rise_ms) {
+    IS31FL3737Breath breath;
+    breath.rise = is31fl3737_abm_ramp_code(rise_ms);
+    breath.end_on = true;
+    breath.loops = 1;
+    return breath;
+  }
+  // Repeating rise/hold/fall/off
+  static IS31FL3737Breath pulse(uint32_t rise_ms, uint32_t hold_ms, uint32_t fall_ms, uint32_t off_ms,
+                                uint16_t loops = 0) {
+    IS31FL3737Breath breath;
+    breath.rise = is31fl3737_abm_ramp_code(rise_ms);
+    breath.hold = is31fl3737_abm_hold_code(hold_ms);
+    breath.fall = is31fl3737_abm_ramp_code(fall_ms);
+    breath.off = is31fl3737_abm_hold_code(off_ms, IS31FL3737_ABM_OFF_MAX_CODE);
+    breath.loops = loops > IS31FL3737_ABM_MAX_LOOPS ? IS31FL3737_ABM_MAX_LOOPS : loops;
+    return breath;
+  }
+
+  uint32_t period_ms() const {
+    return is31fl3737_abm_ramp_ms(this->rise) + is31fl3737_abm_hold_ms(this->hold) +
+           is31fl3737_abm_ramp_ms(this->fall) + is31fl3737_abm_hold_ms(this->off);
+  }
+};
+
 /**
  * Driver for a single IS31FL3737 chip (12×12 matrix)
  */
@@ -30,19 +111,53 @@ class IS31FL3737Driver {
   void reset();
 
   // Display control
-  void show();  // Push buffer to hardware
+  void show();  // Push changed registers to hardware (blocking)
+  
+  // Incremental push: start_show() takes the current register image, then each
+  // show_step() call sends one burst write (plus page select on the first).
+  // Returns true once the frame is fully on the chip. Leave the register image
+  // alone until then.
+  void start_show();
+  bool show_step();
+  bool is_show_pending() const { return push_pending_; }
+  
+  // Coalesced push: request_show() after changing the register image, then
+  // flush() once per loop sends one frame for all requests since the last flush.
+  // Returns true if a frame was pushed.
+  void request_show();
+  bool flush();
+  // flush() for a bus scheduler: begins the push (false if nothing was
+  // requested), then show_step() sends it. The image may keep changing
+  // meanwhile; registers already sent go out again with the next flush.
+  bool start_flush();
+  bool is_flush_pending() const { return show_requested_; }
   void clear(); // Clear buffer
 
   // Pixel operations
   void set_pixel(uint8_t x, uint8_t y, uint8_t brightness);
   uint8_t get_pixel(uint8_t x, uint8_t y) const;
+  
+  // Direct access to the PWM register image (192 bytes, hardware layout).
+  // For callers with precomputed register addresses; see retrotext_layout.h
+  uint8_t *register_image() { return pwm_registers_.data(); }
 
   // Configuration
   void set_global_current(uint8_t current);
   
+  // Auto breath: the chip fades LEDs on its own with no further bus traffic.
+  // Configure a waveform, switch LEDs to it, then start_breath() to latch the
+  // timing and (re)start every breathing LED from T1. Mode IS31FL3737_LED_MODE_PWM
+  // hands an LED back to its PWM register.
+  bool set_breath(uint8_t abm, const IS31FL3737Breath &breath);  // abm = 1-3
+  bool set_led_mode(uint8_t x, uint8_t y, uint8_t mode);
+  uint8_t get_led_mode(uint8_t x, uint8_t y) const;
+  bool start_breath();
+  
   // Status
   bool is_initialized() const { return initialized_; }
   uint8_t get_address() const { return address_; }
+  const IS31FL3737Stats &get_stats() const { return stats_; }
+  void reset_stats() { stats_ = IS31FL3737Stats(); }
 
  protected:
   // I2C bus and address
@@ -50,19 +165,43 @@ class IS31FL3737Driver {
   uint8_t address_{0};
   bool initialized_{false};
   
-  // PWM buffer (12×12 = 144 pixels)
-  std::array<uint8_t, IS31FL3737_PWM_BUFFER_SIZE> pwm_buffer_;
+  // PWM register image in hardware layout (12 rows × 16-byte stride)
+  // Registers for unused CS lines stay zero
+  std::array<uint8_t, IS31FL3737_PWM_REGISTER_SIZE> pwm_registers_{};
+  
+  // Last PWM register image successfully sent to the chip
+  std::array<uint8_t, IS31FL3737_PWM_REGISTER_SIZE> shadow_;
+  bool shadow_valid_{false};  // False until the first full push, and after reset or I2C error
+  IS31FL3737Stats stats_;
+  
+  // Incremental push state
+  bool push_pending_{false};
+  bool push_full_{false};           // Whole image in fixed chunks (no valid shadow)
+  bool push_page_selected_{false};
+  bool push_ok_{true};
+  uint16_t push_position_{0};       // Next register to send or scan from
+  bool show_requested_{false};      // request_show() since the last flush()
+  
+  // Page the command register points at, or IS31FL3737_PAGE_UNKNOWN after reset or an I2C error
+  uint8_t current_page_{IS31FL3737_PAGE_UNKNOWN};
   
   // Global current setting
   uint8_t global_current_{128};
+  
+  // Function page configuration register (SSD, B_EN once breathing is used)
+  uint8_t config_{IS31FL3737_CONFIG_SSD};
+  
+  // ABM page image (mode per LED, PWM layout); mirrors the chip, writes are immediate
+  std::array<uint8_t, IS31FL3737_PWM_REGISTER_SIZE> led_modes_{};
 
   // Low-level I2C operations
   bool select_page_(uint8_t page);
   bool write_register_(uint8_t reg, uint8_t value);
   bool read_register_(uint8_t reg, uint8_t *value);
+  bool bus_write_(const uint8_t *data, size_t len);  // Counts writes, forgets the page on error
   
-  // Coordinate mapping
-  uint16_t coord_to_register_(uint8_t x, uint8_t y) const;
+  bool write_pwm_run_(uint8_t start, uint8_t length);
+  bool find_changed_run_(uint16_t from, uint16_t &run_start, uint16_t &run_end) const;
   
   // Helper methods
   bool enable_all_leds_();
@@ -29,10 +29,54 @@ constexpr uint8_t IS31FL3737_PAGE_FUNCTION = 0x03;  // Configuration
 // Function page registers
 constexpr uint8_t IS31FL3737_REG_CONFIG = 0x00;         // Configuration register
 constexpr uint8_t IS31FL3737_REG_GLOBAL_CURRENT = 0x01; // Global current control
+constexpr uint8_t IS31FL3737_REG_ABM1 = 0x02;           // ABM-1 control registers 1-4 (ABM-2 at 0x06, ABM-3 at 0x0A)
+constexpr uint8_t IS31FL3737_REG_TIME_UPDATE = 0x0E;    // Write 0x00 to latch ABM timing and restart breathing
 constexpr uint8_t IS31FL3737_REG_RESET = 0x11;          // Software reset
 
 // Configuration register bits
-constexpr uint8_t IS31FL3737_CONFIG_SSD = 0x01;  // Software Shutdown (0=shutdown, 1=normal)
+constexpr uint8_t IS31FL3737_CONFIG_SSD = 0x01;   // Software Shutdown (0=shutdown, 1=normal)
+constexpr uint8_t IS31FL3737_CONFIG_B_EN = 0x02;  // Auto breath enable (LEDs set to ABM-n on page 2 breathe)
+
+// Auto Breath Mode (ABM page holds one mode register per LED, same layout as the PWM page)
+constexpr uint8_t IS31FL3737_ABM_COUNT = 3;           // ABM-1, ABM-2, ABM-3
+constexpr uint8_t IS31FL3737_LED_MODE_PWM = 0;        // LED follows its PWM register
+constexpr uint16_t IS31FL3737_ABM_MAX_LOOPS = 0x3FF;  // 10-bit loop count, 0 = endless
+
+// ABM timing codes. Rise (T1) and fall (T3): 0.21 s << code, code 0-7.
+// Hold (T2, code 0-8) and off (T4, code 0-10): 0 s for code 0, else 0.21 s << (code - 1).
+constexpr uint32_t IS31FL3737_ABM_BASE_MS = 210;
+constexpr uint8_t IS31FL3737_ABM_RAMP_MAX_CODE = 7;
+constexpr uint8_t IS31FL3737_ABM_HOLD_MAX_CODE = 8;
+constexpr uint8_t IS31FL3737_ABM_OFF_MAX_CODE = 10;
+
+constexpr uint32_t is31fl3737_abm_ramp_ms(uint8_t code) { return IS31FL3737_ABM_BASE_MS << code; }
+constexpr uint32_t is31fl3737_abm_hold_ms(uint8_t code) {
+  return code == 0 ? 0 : IS31FL3737_ABM_BASE_MS << (code - 1);
+}
+
+// Nearest timing code for a duration
+constexpr uint8_t is31fl3737_abm_ramp_code(uint32_t ms) {
+  uint8_t code = 0;
+  while (code < IS31FL3737_ABM_RAMP_MAX_CODE && ms > is31fl3737_abm_ramp_ms(code)) {
+    uint32_t next = is31fl3737_abm_ramp_ms(code + 1);
+    if (next > ms && next - ms >= ms - is31fl3737_abm_ramp_ms(code)) {
+      break;
+    }
+    code++;
+  }
+  return code;
+}
+constexpr uint8_t is31fl3737_abm_hold_code(uint32_t ms, uint8_t max_code = IS31FL3737_ABM_HOLD_MAX_CODE) {
+  uint8_t code = 0;
+  while (code < max_code && ms > is31fl3737_abm_hold_ms(code)) {
+    uint32_t next = is31fl3737_abm_hold_ms(code + 1);
+    if (next > ms && next - ms >= ms - is31fl3737_abm_hold_ms(code)) {
+      break;
+    }
+    code++;
+  }
+  return code;
+}
 
 // Matrix dimensions for IS31FL3737
 constexpr uint8_t IS31FL3737_MATRIX_WIDTH = 12;
@@ -42,6 +86,16 @@ constexpr uint16_t IS31FL3737_PWM_BUFFER_SIZE = 144;  // 12×12
 // Register stride (columns per row in register space)
 constexpr uint8_t IS31FL3737_REGISTER_STRIDE = 16;
 
+// PWM page register image: 12 rows × 16-byte stride = 192 bytes (0x00-0xBF)
+constexpr uint16_t IS31FL3737_PWM_REGISTER_SIZE = IS31FL3737_MATRIX_HEIGHT * IS31FL3737_REGISTER_STRIDE;
+
+// PWM register address for a 0-based matrix coordinate (CSx = x + 1, SWy = y + 1)
+// IS31FL3737 hardware quirk: CS7-CS12 are remapped to CS9-CS14 in register space
+// (documented in the IS31FL373x driver library, line 365-368)
+constexpr uint8_t is31fl3737_pwm_register(uint8_t x, uint8_t y) {
+  return static_cast<uint8_t>(y * IS31FL3737_REGISTER_STRIDE + (x >= 6 ? x + 2 : x));
+}
+
 // ADDR pin to I2C address mapping (from IS31FL373x driver lib)
 // Base address: 0b1010000 (0x50)
 enum class IS31FL3737_ADDR {
@@ -3,7 +3,6 @@
  * Implementation
  */
 #include "retrotext_display.h"
-#include "font_4x6.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
@@ -16,8 +15,8 @@ void RetroTextDisplay::setup() {
   ESP_LOGCONFIG(TAG, "Setting up RetroText Display...");
   
   // Clear buffers
-  this->buffer_.fill(0);
-  this->text_buffer_[0] = '\0';
+  this->clear_framebuffer_();
+  this->glyph_count_ = 0;
   this->text_dirty_ = false;
   
   // Initialize all 3 IS31FL3737 boards
@@ -35,56 +34,50 @@ void RetroTextDisplay::setup() {
 }
 
 void RetroTextDisplay::loop() {
-  // Update shimmer animation phase
-  if (this->shimmer_enabled_) {
-    this->shimmer_phase_ += 0.15f;  // Animation speed
-    if (this->shimmer_phase_ >= 6.28318530718f) {  // 2*PI
-      this->shimmer_phase_ -= 6.28318530718f;
-    }
-    // Force display update when shimmering
-    this->update_display_();
-  }
+  uint32_t now = millis();
   
-  // Render text if it changed
-  if (this->text_dirty_) {
-    this->render_text_();
-    this->update_display_();
-    this->text_dirty_ = false;
+  // Advance shimmer animation on its own frame clock (not every loop iteration)
+  if (this->shimmer_enabled_ && now - this->last_shimmer_frame_ >= this->shimmer_interval_ms_) {
+    this->last_shimmer_frame_ = now;
+    this->shimmer_phase_ = shimmer_phase_at(now - this->shimmer_start_time_);
+    this->invalidate_frame_();
   }
   
   // Handle scrolling for long text
-  bool should_scroll = false;
-  if (this->scroll_mode_ == SCROLL_ALWAYS) {
-    should_scroll = true;
-  } else if (this->scroll_mode_ == SCROLL_AUTO && this->text_length_ > 18) {
-    should_scroll = true;
-  }
-  
-  if (should_scroll) {
-    uint32_t now = millis();
-    
-    // Wait scroll_start_delay_ms before starting to scroll (gives user time to read)
-    if (now - this->text_set_time_ < this->scroll_start_delay_ms_) {
-      return;  // Don't scroll yet
-    }
-    
-    if (now - this->last_scroll_time_ >= this->scroll_delay_ms_) {
+  // Wait scroll_start_delay_ms before starting to scroll (gives user time to read)
+  if (this->should_scroll_() && now - this->text_set_time_ >= this->scroll_start_delay_ms_) {
+    // Smooth mode moves one pixel at a time at the same character rate
+    uint32_t step_delay = this->smooth_scroll_ ? this->scroll_delay_ms_ / GLYPH_WIDTH : this->scroll_delay_ms_;
+    if (now - this->last_scroll_time_ >= step_delay) {
       this->last_scroll_time_ = now;
       
-      // Advance scroll position
-      this->scroll_position_++;
-      
-      // Calculate max scroll position (text length + 3 spaces for wrap-around)
-      int max_position = this->text_length_ + 3;
-      if (this->scroll_position_ >= max_position) {
-        this->scroll_position_ = 0;
+      // Advance the window over the strip (wraps after the " * " separator)
+      this->scroll_offset_ += this->smooth_scroll_ ? 1 : GLYPH_WIDTH;
+      if (this->scroll_offset_ >= this->strip_columns_) {
+        this->scroll_offset_ = 0;
       }
       
       // Re-render at new position
-      this->render_text_();
-      this->update_display_();
+      this->text_dirty_ = true;
+      this->invalidate_frame_();
     }
   }
+  
+  // Frame tick: everything above only marks the frame dirty; render and push at most once per tick.
+  // A frame still being pushed owns the register images, so the next one waits for it.
+  if (this->frame_dirty_ && !this->push_pending_ && now - this->last_frame_time_ >= this->frame_interval_ms_) {
+    this->last_frame_time_ = now;
+    this->render_frame_();
+  }
+  
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    return;  // The arbiter steps the push (see render_frame_())
+  }
+#endif
+  if (this->push_pending_) {
+    this->service_push_();
+  }
 }
 
 void RetroTextDisplay::dump_config() {
@@ -100,7 +93,42 @@ void RetroTextDisplay::dump_config() {
   else if (this->scroll_mode_ == SCROLL_ALWAYS) scroll_mode_str = "always";
   else if (this->scroll_mode_ == SCROLL_NEVER) scroll_mode_str = "never";
   ESP_LOGCONFIG(TAG, "  Scroll Mode: %s", scroll_mode_str);
-  ESP_LOGCONFIG(TAG, "  Scroll Delay: %dms", this->scroll_delay_ms_);
+  ESP_LOGCONFIG(TAG, "  Scroll Delay: %ums%s", (unsigned) this->scroll_delay_ms_,
+                this->smooth_scroll_ ? " (smooth)" : "");
+  ESP_LOGCONFIG(TAG, "  Shimmer Frame Interval: %ums", (unsigned) this->shimmer_interval_ms_);
+  
+  const DisplayFrameStats &frames = this->frame_stats_;
+  ESP_LOGCONFIG(TAG, "  Frames: %u rendered, %u coalesced, %u over %ums budget", (unsigned) frames.frames_rendered,
+                (unsigned) frames.frames_dropped, (unsigned) frames.frames_over_budget,
+                (unsigned) this->frame_interval_ms_);
+  ESP_LOGCONFIG(TAG, "  Push Time: last %uus, avg %uus, max %uus", (unsigned) frames.push_time_last_us,
+                (unsigned) frames.average_push_us(), (unsigned) frames.push_time_max_us);
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Push: I2C arbiter bulk jobs, longest blocking section %uus",
+                  (unsigned) frames.longest_blocking_us);
+  } else
+#endif
+  if (this->push_budget_us_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Push Budget: %uus per loop, longest blocking section %uus", (unsigned) this->push_budget_us_,
+                  (unsigned) frames.longest_blocking_us);
+  } else {
+    ESP_LOGCONFIG(TAG, "  Push Budget: none (blocking), longest blocking section %uus",
+                  (unsigned) frames.longest_blocking_us);
+  }
+  
+  for (size_t i = 0; i < 3; i++) {
+    if (!this->drivers_[i]) {
+      continue;
+    }
+    const IS31FL3737Stats &stats = this->drivers_[i]->get_stats();
+    ESP_LOGCONFIG(TAG, "  Board %d I2C: %u frames (%u unchanged), %u bytes in %u writes, saved %d bytes / %d writes",
+                  (int) (i + 1), (unsigned) stats.frames, (unsigned) stats.frames_unchanged,
+                  (unsigned) stats.bytes_written, (unsigned) stats.transactions, (int) stats.bytes_saved(),
+                  (int) stats.transactions_saved());
+    ESP_LOGCONFIG(TAG, "  Board %d bus: %u writes, %u page selects (%u skipped)", (int) (i + 1),
+                  (unsigned) stats.bus_writes, (unsigned) stats.page_selects, (unsigned) stats.page_selects_skipped);
+  }
   
   if (this->is_failed()) {
     ESP_LOGE(TAG, "  FAILED - Communication error");
@@ -123,35 +151,34 @@ void RetroTextDisplay::set_text(const char *text) {
     return;
   }
   
-  // Clear the text buffer first
-  memset(this->text_buffer_, 0, sizeof(this->text_buffer_));
-  
-  // Copy text to buffer (up to MAX_TEXT_LENGTH)
-  strncpy(this->text_buffer_, text, MAX_TEXT_LENGTH - 1);
-  this->text_buffer_[MAX_TEXT_LENGTH - 1] = '\0';
+  // Transliterate UTF-8 once; everything after this works on glyph indices
+  this->decode_text_(text);
   
-  // Calculate actual text length
-  this->text_length_ = strlen(this->text_buffer_);
-  
-  // Detect stationary prefix (icon + space = 2 chars)
+  // Detect stationary prefix (icon + space = 2 glyphs)
   // Check if text starts with play (128) or stop (129) icon
   this->stationary_prefix_chars_ = 0;
-  if (this->text_length_ >= 2) {
-    uint8_t first_byte = (uint8_t)this->text_buffer_[0];
-    if ((first_byte == 128 || first_byte == 129) && this->text_buffer_[1] == ' ') {
+  if (this->glyph_count_ >= 2) {
+    uint8_t first_glyph = this->glyphs_[0];
+    if ((first_glyph == 128 || first_glyph == 129) && this->glyphs_[1] == ' ') {
       this->stationary_prefix_chars_ = 2;  // Icon + space stay put
     }
   }
   
+  // Rasterize the scrollable part once; scrolling only moves a window over it
+  this->build_scroll_strip_();
+  
   // Reset scroll position and timing when text changes
-  this->scroll_position_ = 0;
+  this->scroll_offset_ = 0;
   uint32_t now = millis();
   this->text_set_time_ = now;      // Record when text was set
   this->last_scroll_time_ = now;   // Reset scroll timer
   
+  this->split_pos_ = -1;
   this->text_dirty_ = true;
+  this->invalidate_frame_();
   
-  ESP_LOGD(TAG, "Set text: '%s' (prefix_chars=%d)", this->text_buffer_, this->stationary_prefix_chars_);
+  ESP_LOGD(TAG, "Set text: '%s' (%u glyphs, prefix_chars=%d)", text, this->glyph_count_,
+           this->stationary_prefix_chars_);
 }
 
 void RetroTextDisplay::set_text_with_brightness(const char *text, uint8_t date_brightness, uint8_t time_brightness, int split_pos) {
@@ -159,43 +186,38 @@ void RetroTextDisplay::set_text_with_brightness(const char *text, uint8_t date_b
     return;
   }
   
-  // Clear the text buffer and framebuffer
-  memset(this->text_buffer_, 0, sizeof(this->text_buffer_));
-  this->buffer_.fill(0);
-  
-  // Copy text to buffer
-  strncpy(this->text_buffer_, text, MAX_TEXT_LENGTH - 1);
-  this->text_buffer_[MAX_TEXT_LENGTH - 1] = '\0';
-  this->text_length_ = strlen(this->text_buffer_);
-  
-  // Render with variable brightness and UTF-8 support
-  int x_pos = 0;
-  size_t byte_pos = 0;
-  int char_count = 0;
-  
-  while (byte_pos < this->text_length_ && char_count < 18) {
-    size_t bytes_consumed = 0;
-    uint8_t glyph = map_utf8_to_glyph(&this->text_buffer_[byte_pos], bytes_consumed);
-    
-    uint8_t char_brightness = (char_count < split_pos) ? date_brightness : time_brightness;
-    this->draw_character_(glyph, x_pos, char_brightness);
-    x_pos += 4;
-    
-    byte_pos += bytes_consumed;
-    char_count++;
-  }
+  this->decode_text_(text);
   
-  // Update display immediately (bypass normal render cycle)
-  this->update_display_();
+  // Rendered with per-character brightness on the next frame tick
+  this->stationary_prefix_chars_ = 0;
+  this->date_brightness_ = date_brightness;
+  this->time_brightness_ = time_brightness;
+  this->split_pos_ = split_pos < 0 ? 0 : split_pos;
+  this->text_dirty_ = true;
+  this->invalidate_frame_();
   
-  // Reset scroll state
-  this->scroll_position_ = 0;
+  // Reset scroll state (split text is static, no strip needed)
+  this->strip_columns_ = 0;
+  this->scroll_glyphs_ = 0;
+  this->scroll_offset_ = 0;
   uint32_t now = millis();
   this->text_set_time_ = now;
   this->last_scroll_time_ = now;
   
   ESP_LOGV(TAG, "Set text with brightness: '%s' (date:%d, time:%d, split:%d)", 
-           this->text_buffer_, date_brightness, time_brightness, split_pos);
+           text, date_brightness, time_brightness, split_pos);
+}
+
+void RetroTextDisplay::decode_text_(const char *text) {
+  // One glyph index per displayed character, however many UTF-8 bytes it took
+  uint8_t count = 0;
+  size_t byte_pos = 0;
+  while (text[byte_pos] != '\0' && count < MAX_TEXT_LENGTH) {
+    size_t bytes_consumed = 0;
+    this->glyphs_[count++] = map_utf8_to_glyph(&text[byte_pos], bytes_consumed);
+    byte_pos += bytes_consumed;
+  }
+  this->glyph_count_ = count;
 }
 
 void RetroTextDisplay::set_brightness(uint8_t brightness) {
@@ -210,21 +232,28 @@ void RetroTextDisplay::set_brightness(uint8_t brightness) {
 }
 
 void RetroTextDisplay::clear() {
-  this->buffer_.fill(0);
-  this->text_buffer_[0] = '\0';
-  this->update_display_();
+  this->glyph_count_ = 0;
+  this->stationary_prefix_chars_ = 0;
+  this->split_pos_ = -1;
+  this->build_scroll_strip_();
+  this->scroll_offset_ = 0;
+  this->text_dirty_ = true;
+  this->invalidate_frame_();
   ESP_LOGD(TAG, "Display cleared");
 }
 
 void RetroTextDisplay::set_shimmer_mode(bool enabled) {
   this->shimmer_enabled_ = enabled;
   if (enabled) {
-    this->shimmer_phase_ = 0.0f;  // Reset phase
+    // Restart the wave and draw the first frame on the next loop
+    this->shimmer_phase_ = 0;
+    this->shimmer_start_time_ = millis();
+    this->last_shimmer_frame_ = this->shimmer_start_time_ - this->shimmer_interval_ms_;
     ESP_LOGD(TAG, "Shimmer mode enabled");
   } else {
     ESP_LOGD(TAG, "Shimmer mode disabled");
-    // Force one final update with normal brightness
-    this->update_display_();
+    // One final frame with normal brightness
+    this->invalidate_frame_();
   }
 }
 
@@ -245,14 +274,14 @@ bool RetroTextDisplay::initialize_boards_() {
     
     // Initialize the driver
     if (!this->drivers_[i]->begin(addr, this->i2c_bus_)) {
-      ESP_LOGE(TAG, "Failed to initialize board %d at address 0x%02X", i + 1, addr);
+      ESP_LOGE(TAG, "Failed to initialize board %d at address 0x%02X", (int) (i + 1), addr);
       return false;
     }
     
     // Set brightness/current
     this->drivers_[i]->set_global_current(this->brightness_ / 2);  // Scale down for current control
     
-    ESP_LOGD(TAG, "Board %d at 0x%02X: initialized", i + 1, addr);
+    ESP_LOGD(TAG, "Board %d at 0x%02X: initialized", (int) (i + 1), addr);
   }
   
   return true;
@@ -260,231 +289,219 @@ bool RetroTextDisplay::initialize_boards_() {
 
 void RetroTextDisplay::render_text_() {
   // Clear buffer
-  this->buffer_.fill(0);
+  this->clear_framebuffer_();
   
-  // Check if we should scroll (accounting for stationary prefix)
-  size_t scrollable_length = this->text_length_ - this->stationary_prefix_chars_;
-  size_t available_display_chars = 18 - this->stationary_prefix_chars_;
-  
-  bool should_scroll = false;
-  if (this->scroll_mode_ == SCROLL_ALWAYS && scrollable_length > 0) {
-    should_scroll = true;
-  } else if (this->scroll_mode_ == SCROLL_AUTO && scrollable_length > available_display_chars) {
-    should_scroll = true;
+  // Static text with two brightness levels (clock: date dimmer than time)
+  if (this->split_pos_ >= 0) {
+    for (int i = 0; i < this->glyph_count_ && i < 18; i++) {
+      uint8_t char_brightness = (i < this->split_pos_) ? this->date_brightness_ : this->time_brightness_;
+      this->draw_character_(this->glyphs_[i], i * GLYPH_WIDTH, char_brightness);
+    }
+    return;
   }
   
   int x_pos = 0;
   
   // FIRST: Render stationary prefix (icon + space) if present
-  if (this->stationary_prefix_chars_ > 0) {
-    for (uint8_t i = 0; i < this->stationary_prefix_chars_ && i < this->text_length_; i++) {
-      size_t bytes_consumed = 0;
-      uint8_t glyph = map_utf8_to_glyph(&this->text_buffer_[i], bytes_consumed);
-      this->draw_character_(glyph, x_pos, this->brightness_);
-      x_pos += 4;
-    }
+  for (uint8_t i = 0; i < this->stationary_prefix_chars_; i++) {
+    this->draw_character_(this->glyphs_[i], x_pos, this->brightness_);
+    x_pos += GLYPH_WIDTH;
   }
   
-  // SECOND: Render scrollable portion
-  if (should_scroll && scrollable_length > 0) {
-    // Scrolling text - render after the prefix
-    // Scrollable text starts at stationary_prefix_chars_ offset in buffer
-    for (size_t display_pos = 0; display_pos < available_display_chars; display_pos++) {
-      // Calculate position in scrollable portion (with wraparound)
-      int text_pos = (this->scroll_position_ + display_pos) % (scrollable_length + 3);
-      
-      uint8_t glyph;
-      if (text_pos < (int)scrollable_length) {
-        // Character from scrollable text
-        size_t bytes_consumed = 0;
-        size_t buffer_pos = this->stationary_prefix_chars_ + text_pos;
-        glyph = map_utf8_to_glyph(&this->text_buffer_[buffer_pos], bytes_consumed);
-      } else {
-        // Separator between scroll cycles: " * "
-        int separator_pos = text_pos - scrollable_length;
-        if (separator_pos == 0 || separator_pos == 2) {
-          glyph = ' ';
-        } else {
-          glyph = '*';
-        }
+  // SECOND: Copy the scrollable portion from the pre-rendered strip (no glyph decoding)
+  if (this->should_scroll_()) {
+    // Window of the remaining columns starting at scroll_offset_, wrapping around the strip
+    uint16_t src = this->scroll_offset_;
+    for (int x = x_pos; x < DISPLAY_WIDTH; x++) {
+      this->columns_[x] = this->scroll_strip_[src];
+      this->column_brightness_[x] = this->brightness_;
+      if (++src >= this->strip_columns_) {
+        src = 0;
       }
-      
-      this->draw_character_(glyph, x_pos, this->brightness_);
-      x_pos += 4;
     }
   } else {
-    // Static display - no scrolling, render remaining chars after prefix
-    size_t byte_pos = this->stationary_prefix_chars_;
-    int char_count = this->stationary_prefix_chars_;
-    
-    while (byte_pos < this->text_length_ && char_count < 18) {
-      size_t bytes_consumed = 0;
-      uint8_t glyph = map_utf8_to_glyph(&this->text_buffer_[byte_pos], bytes_consumed);
-      
-      this->draw_character_(glyph, x_pos, this->brightness_);
-      x_pos += 4;
-      
-      byte_pos += bytes_consumed;
-      char_count++;
+    // Static display - text only, without the separator, truncated at the right edge
+    int text_columns = this->scroll_glyphs_ * GLYPH_WIDTH;
+    for (int src = 0; src < text_columns && x_pos < DISPLAY_WIDTH; src++, x_pos++) {
+      this->columns_[x_pos] = this->scroll_strip_[src];
+      this->column_brightness_[x_pos] = this->brightness_;
     }
   }
 }
 
-void RetroTextDisplay::update_display_() {
-  // Push buffer to all 3 IS31FL3737 boards
-  // Using coordinate mapping from working DisplayManager.cpp
+void RetroTextDisplay::build_scroll_strip_() {
+  uint16_t columns = 0;
+  uint16_t glyphs = 0;
+  
+  // Scrollable text after the stationary prefix
+  for (uint16_t i = this->stationary_prefix_chars_; i < this->glyph_count_; i++) {
+    memcpy(&this->scroll_strip_[columns], glyph_columns(this->glyphs_[i]), GLYPH_WIDTH);
+    columns += GLYPH_WIDTH;
+    glyphs++;
+  }
   
-  // Clear all driver PWM buffers first
-  for (int i = 0; i < 3; i++) {
-    if (this->drivers_[i] && this->drivers_[i]->is_initialized()) {
-      this->drivers_[i]->clear();
-    }
+  // Separator between scroll cycles: " * "
+  static const char SEPARATOR[] = " * ";
+  for (size_t i = 0; i < 3; i++) {
+    memcpy(&this->scroll_strip_[columns], glyph_columns(SEPARATOR[i]), GLYPH_WIDTH);
+    columns += GLYPH_WIDTH;
   }
   
-  // Process all pixels and determine board AFTER coordinate flip
-  for (int y = 0; y < 6; y++) {
-    for (int x = 0; x < 72; x++) {
-      int buffer_index = y * 72 + x;
-      uint8_t pixel_brightness = this->buffer_[buffer_index];
-      
-      // Apply shimmer effect if enabled
-      if (this->shimmer_enabled_ && pixel_brightness > 0) {
-        // Calculate wave position: sine wave moving from left to right
-        // with vertical offset to create angled wave effect
-        float wave_position = (float)x / 72.0f * 12.56637061436f;  // 2 full periods across display
-        float vertical_offset = (float)y * 0.523598775598f;  // PI/6 offset per row for angle
-        float wave = sinf(wave_position + vertical_offset - this->shimmer_phase_);
-        
-        // Modulate brightness: 0.6 to 1.4 multiplier (keeps pixels visible but creates wave)
-        float brightness_mult = 1.0f + (wave * 0.4f);
-        pixel_brightness = (uint8_t)(pixel_brightness * brightness_mult);
-        
-        // Clamp to valid range
-        if (pixel_brightness > 255) pixel_brightness = 255;
-      }
-      
-      // Write ALL pixels (including zeros) to properly clear the display
-      
-      // Apply coordinate flip (from DisplayManager.cpp line 131-132)
-      // Display is mounted upside down, so flip both X and Y
-      int screen_x = (72 - x - 1);  // Flip X across entire display
-      int screen_y = (6 - y - 1);   // Flip Y
-      
-      // Determine which board AFTER coordinate flip (from DisplayManager.cpp line 135)
-      int board = screen_x / 24;
-      if (board < 0 || board >= 3 || !this->drivers_[board] || !this->drivers_[board]->is_initialized()) {
-        continue;
-      }
-      
-      // Calculate local coordinates within the board
-      int local_x = screen_x % 24;  // 0-23 within board
-      int local_y = screen_y;       // 0-5
-      
-      // Convert 24×6 logical to 12×12 physical (from DisplayManager.cpp line 144-157)
-      // RetroText PCB layout: 6 characters in a row
-      // - Characters 0,1,2 use SW1-6 (top half: CS1-4, CS5-8, CS9-12)
-      // - Characters 3,4,5 use SW7-12 (bottom half: CS1-4, CS5-8, CS9-12)
-      int char_index = local_x / 4;      // Which character (0-5) within board
-      int char_pixel_x = local_x % 4;    // Pixel within character (0-3)
-      
-      int physical_x, physical_y;
-      
-      if (char_index < 3) {
-        // Characters 0,1,2: use SW1-6 (top half)
-        physical_x = (char_index * 4) + char_pixel_x;  // CS1-4, CS5-8, CS9-12
-        physical_y = local_y;  // SW1-6 (rows 0-5)
-      } else {
-        // Characters 3,4,5: use SW7-12 (bottom half)
-        physical_x = ((char_index - 3) * 4) + char_pixel_x;  // CS1-4, CS5-8, CS9-12
-        physical_y = local_y + 6;  // SW7-12 (rows 6-11)
-      }
-      
-      this->drivers_[board]->set_pixel(physical_x, physical_y, pixel_brightness);
-    }
+  this->scroll_glyphs_ = glyphs;
+  this->strip_columns_ = columns;
+}
+
+bool RetroTextDisplay::should_scroll_() const {
+  // Static two-brightness text (clock) never scrolls
+  if (this->split_pos_ >= 0 || this->scroll_glyphs_ == 0) {
+    return false;
+  }
+  if (this->scroll_mode_ == SCROLL_ALWAYS) {
+    return true;
+  }
+  // Check if we should scroll (accounting for stationary prefix)
+  size_t available_display_chars = 18 - this->stationary_prefix_chars_;
+  return this->scroll_mode_ == SCROLL_AUTO && this->scroll_glyphs_ > available_display_chars;
+}
+
+void RetroTextDisplay::invalidate_frame_() {
+  // A frame already pending absorbs this change: one push instead of two
+  if (this->frame_dirty_) {
+    this->frame_stats_.frames_dropped++;
+  }
+  this->frame_dirty_ = true;
+}
+
+void RetroTextDisplay::render_frame_() {
+  if (this->text_dirty_) {
+    this->render_text_();
+    this->text_dirty_ = false;
   }
   
-  // Push all boards to hardware
-  for (size_t board = 0; board < 3; board++) {
-    if (this->drivers_[board] && this->drivers_[board]->is_initialized()) {
-      this->drivers_[board]->show();
+  uint32_t start = micros();
+  this->update_display_();
+  this->frame_busy_us_ = micros() - start;
+  
+  this->frame_dirty_ = false;
+  this->frame_sequence_++;
+  this->frame_stats_.frames_rendered++;
+  
+  // Hand the register images to the drivers; service_push_() sends them
+  for (size_t board = 0; board < DISPLAY_BOARDS; board++) {
+    if (this->drivers_[board]) {
+      this->drivers_[board]->start_show();
     }
   }
-  
-  // ESP_LOGD(TAG, "Display updated");
+  this->push_board_ = 0;
+  this->push_pending_ = true;
+  
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    this->arbiter_->submit_bulk([this]() {
+      uint32_t start = micros();
+      bool done = this->push_step_();
+      this->note_blocking_(micros() - start);
+      return done;
+    });
+  }
+#endif
 }
 
-void RetroTextDisplay::set_pixel_(int x, int y, uint8_t brightness) {
-  // Bounds check
-  if (x < 0 || x >= 72 || y < 0 || y >= 6) {
-    return;
+void RetroTextDisplay::service_push_() {
+  // With a budget, send burst writes until it is used up and leave the rest for
+  // the next loop, so other components (keypad, encoder) get the loop back.
+  // Without one (0), the whole frame goes out now.
+  uint32_t start = micros();
+  while (!this->push_step_()) {
+    if (this->push_budget_us_ > 0 && micros() - start >= this->push_budget_us_) {
+      break;
+    }
   }
+  this->note_blocking_(micros() - start);
+}
+
+bool RetroTextDisplay::push_step_() {
+  // One show_step() of the board being sent; true once the frame is fully on the hardware
+  uint32_t start = micros();
+  IS31FL3737Driver *driver = this->drivers_[this->push_board_].get();
+  if (driver == nullptr || driver->show_step()) {
+    this->push_board_++;
+  }
+  this->frame_busy_us_ += micros() - start;
   
-  // Set pixel in buffer
-  int index = y * 72 + x;
-  this->buffer_[index] = brightness;
+  if (this->push_board_ < DISPLAY_BOARDS) {
+    return false;
+  }
+  this->complete_push_();
+  return true;
 }
 
-int RetroTextDisplay::get_board_for_x_(int x) const {
-  return x / 24;  // 0-23=board0, 24-47=board1, 48-71=board2
+void RetroTextDisplay::note_blocking_(uint32_t elapsed_us) {
+  if (elapsed_us > this->frame_stats_.longest_blocking_us) {
+    this->frame_stats_.longest_blocking_us = elapsed_us;
+  }
 }
 
-int RetroTextDisplay::get_local_x_(int x) const {
-  return x % 24;  // Local x within the board
+void RetroTextDisplay::complete_push_() {
+  // Frame fully on the hardware
+  this->push_pending_ = false;
+  this->completed_sequence_ = this->frame_sequence_;
+  this->frame_stats_.frames_completed++;
+  this->frame_stats_.push_time_total_us += this->frame_busy_us_;
+  this->frame_stats_.push_time_last_us = this->frame_busy_us_;
+  if (this->frame_busy_us_ > this->frame_stats_.push_time_max_us) {
+    this->frame_stats_.push_time_max_us = this->frame_busy_us_;
+  }
+  if (this->frame_busy_us_ > this->frame_interval_ms_ * 1000) {
+    this->frame_stats_.frames_over_budget++;
+  }
 }
 
-void RetroTextDisplay::draw_character_(uint8_t glyph_index, int x_offset, uint8_t brightness) {
-  // Draw a 4×6 character starting at x_offset
-  // Glyph index should be pre-mapped using map_utf8_to_glyph()
-  for (int row = 0; row < 6; row++) {
-    uint8_t glyph_row = this->get_glyph_row_(glyph_index, row);
+void RetroTextDisplay::update_display_() {
+  // Write the framebuffer straight into each board's PWM register image using the
+  // precomputed pixel → (board, register) table (see retrotext_layout.h).
+  // Every register the display uses is written each frame, so no clear pass is needed.
+  uint8_t unused_board[IS31FL3737_PWM_REGISTER_SIZE];  // Sink for boards that failed to initialize
+  uint8_t *images[DISPLAY_BOARDS];
+  for (size_t board = 0; board < DISPLAY_BOARDS; board++) {
+    bool ready = this->drivers_[board] && this->drivers_[board]->is_initialized();
+    images[board] = ready ? this->drivers_[board]->register_image() : unused_board;
+  }
+  
+  for (int x = 0; x < DISPLAY_WIDTH; x++) {
+    uint8_t column = this->columns_[x];
+    uint8_t brightness = this->column_brightness_[x];
+    const PixelRegister *targets = &PIXEL_MAP.pixels[x * DISPLAY_HEIGHT];
     
-    // Draw 4 pixels for this row with bit reversal
-    for (int col = 0; col < 4; col++) {
-      // Check if bit is set (bits 7-4 in the font data)
-      if (glyph_row & (0x10 << col)) {
-        // Apply bit reversal: 3-col (from DisplayManager.cpp)
-        int x_pos = x_offset + (3 - col);
-        if (x_pos >= 0 && x_pos < 72) {
-          this->set_pixel_(x_pos, row, brightness);
-        }
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+      uint8_t pixel_brightness = (column & (1 << y)) ? brightness : 0;
+      
+      // Apply shimmer effect if enabled (angled sine wave moving left to right, see shimmer.h)
+      if (this->shimmer_enabled_ && pixel_brightness > 0) {
+        pixel_brightness = shimmer_pixel(pixel_brightness, x, y, this->shimmer_phase_);
       }
+      
+      images[targets[y].board][targets[y].reg] = pixel_brightness;
     }
   }
 }
 
-uint8_t RetroTextDisplay::get_glyph_row_(uint8_t glyph_index, int row) const {
-  // Font format: [width, height, first_char, ...glyph_data...]
-  // modern_font4x6[0] = 4 (width)
-  // modern_font4x6[1] = 6 (height)
-  // modern_font4x6[2] = 32 (first ASCII char - space)
-  
-  // Bounds check
-  if (row < 0 || row >= 6) {
-    return 0x00;
-  }
-  
-  // Check if character is in font range
-  // Range: 32-126 (standard ASCII) + 128-159 (extended)
-  if (glyph_index < 32 || (glyph_index > 126 && glyph_index < 128) || glyph_index > 159) {
-    return 0x00;  // Return blank for unsupported characters
-  }
-  
-  // Calculate offset in font array
-  // Header is 3 bytes, then 6 bytes per character
-  uint8_t char_index;
-  if (glyph_index <= 126) {
-    // Standard ASCII range (32-126)
-    char_index = glyph_index - 32;  // Offset from first char (space)
-  } else {
-    // Extended range (128-159)
-    // After ASCII 32-126 (95 chars), we have 127 (1 char), then 128+ (extended)
-    char_index = 95 + (glyph_index - 127);  // 95 ASCII chars, then extended
+void RetroTextDisplay::clear_framebuffer_() {
+  this->columns_.fill(0);
+  this->column_brightness_.fill(0);
+}
+
+void RetroTextDisplay::draw_character_(uint8_t glyph_index, int x_offset, uint8_t brightness) {
+  // Copy the glyph's 4 pre-mirrored columns (see glyph_cache.h)
+  // Glyph index should be pre-mapped using map_utf8_to_glyph()
+  const uint8_t *glyph = glyph_columns(glyph_index);
+  for (int col = 0; col < GLYPH_WIDTH; col++) {
+    int x = x_offset + col;
+    if (x >= 0 && x < DISPLAY_WIDTH) {
+      this->columns_[x] = glyph[col];
+      this->column_brightness_[x] = brightness;
+    }
   }
-  
-  uint16_t glyph_offset = 3 + (char_index * 6) + row;
-  
-  // Return the row data
-  return modern_font4x6[glyph_offset];
 }
 
 }  // namespace retrotext_display
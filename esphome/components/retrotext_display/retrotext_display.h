@@ -13,12 +13,47 @@
 #include "esphome/core/component.h"
 #include "esphome/components/i2c/i2c.h"
 #include "is31fl3737_driver.h"
+#include "retrotext_layout.h"
+#include "shimmer.h"
+#include "glyph_cache.h"
 #include <array>
 #include <memory>
 
+#ifdef USE_I2C_ARBITER
+#include "esphome/components/i2c_arbiter/i2c_arbiter.h"
+#endif
+
 namespace esphome {
 namespace retrotext_display {
 
+// Render rate limit: dirty frames are rendered and pushed at most once per tick
+constexpr uint32_t DISPLAY_FRAME_INTERVAL_MS = 16;
+
+// Default I2C time per loop() for pushing a frame (0 = push whole frames at once)
+constexpr uint32_t DISPLAY_PUSH_BUDGET_US = 2000;
+
+/**
+ * Frame scheduler counters
+ *
+ * Mutations (set_text, scrolling, shimmer steps, ...) only mark the frame dirty.
+ * Changes that land while a frame is already pending are coalesced and counted
+ * as dropped frames - each was a separate full push before the scheduler.
+ */
+struct DisplayFrameStats {
+  uint32_t frames_rendered{0};
+  uint32_t frames_completed{0};    // Frames fully pushed to all boards
+  uint32_t frames_dropped{0};      // Updates absorbed by an already pending frame
+  uint32_t frames_over_budget{0};  // Render + push took longer than one tick
+  uint32_t push_time_last_us{0};   // Render + I2C time of a frame, summed over its slices
+  uint32_t push_time_max_us{0};
+  uint64_t push_time_total_us{0};
+  uint32_t longest_blocking_us{0};  // Longest push slice spent inside one loop() call
+
+  uint32_t average_push_us() const {
+    return this->frames_completed > 0 ? (uint32_t) (this->push_time_total_us / this->frames_completed) : 0;
+  }
+};
+
 class RetroTextDisplay : public Component {
  public:
   void setup() override;
@@ -32,13 +67,31 @@ class RetroTextDisplay : public Component {
   void set_board_addresses(uint8_t addr1, uint8_t addr2, uint8_t addr3);
   void set_scroll_delay(uint32_t delay_ms) { this->scroll_delay_ms_ = delay_ms; }
   void set_scroll_mode(uint8_t mode) { this->scroll_mode_ = mode; }
+  void set_smooth_scroll(bool smooth) { this->smooth_scroll_ = smooth; }
+  void set_shimmer_fps(uint8_t fps) { this->shimmer_interval_ms_ = 1000 / (fps > 0 ? fps : 1); }
 
   // Public API
   void set_text(const char *text);
   void set_text_with_brightness(const char *text, uint8_t date_brightness, uint8_t time_brightness, int split_pos);
   void clear();
+  uint8_t get_glyph_count() const { return this->glyph_count_; }  // Displayed characters in the current text
   void set_shimmer_mode(bool enabled);  // Enable/disable shimmer loading effect
   
+  // Frame scheduler
+  void set_frame_interval(uint32_t interval_ms) { this->frame_interval_ms_ = interval_ms; }
+  void set_push_budget(uint32_t budget_us) { this->push_budget_us_ = budget_us; }
+#ifdef USE_I2C_ARBITER
+  // Frames go out as bulk jobs on the arbiter (one burst write per step) instead of the push budget
+  void set_i2c_arbiter(i2c_arbiter::I2CArbiter *arbiter) { this->arbiter_ = arbiter; }
+#endif
+  const DisplayFrameStats &get_frame_stats() const { return this->frame_stats_; }
+  
+  // Frame fence: get_frame_fence() names the frame that will contain every change
+  // made so far; is_frame_complete() turns true once it has fully reached the boards
+  uint32_t get_frame_fence() const { return this->frame_sequence_ + (this->frame_dirty_ ? 1 : 0); }
+  bool is_frame_complete(uint32_t fence) const { return this->completed_sequence_ >= fence; }
+  void reset_frame_stats() { this->frame_stats_ = DisplayFrameStats(); }
+  
   // Scroll modes
   enum ScrollMode {
     SCROLL_AUTO = 0,    // Scroll only if text > 18 chars
@@ -55,13 +108,38 @@ class RetroTextDisplay : public Component {
   // IS31FL3737 drivers (one per board)
   std::array<std::unique_ptr<IS31FL3737Driver>, 3> drivers_;
   
-  // Display buffer (72 columns × 6 rows)
-  std::array<uint8_t, 72 * 6> buffer_;
+  // Column-major framebuffer (72 columns × 6 rows): bit N of a column is row N,
+  // and each column has one brightness (characters never share a column)
+  std::array<uint8_t, DISPLAY_WIDTH> columns_;
+  std::array<uint8_t, DISPLAY_WIDTH> column_brightness_;
+  
+  // Current text as glyph indices, transliterated from UTF-8 once in set_text()
+  static const size_t MAX_TEXT_LENGTH = 128;  // Glyphs, not bytes
+  std::array<uint8_t, MAX_TEXT_LENGTH> glyphs_;
+  uint8_t glyph_count_{0};
+  bool text_dirty_{false};   // Text must be re-rendered into columns_
+  
+  // Brightness split (set_text_with_brightness); -1 = single brightness
+  int split_pos_{-1};
+  uint8_t date_brightness_{0};
+  uint8_t time_brightness_{0};
   
-  // Text buffer (increased to support scrolling longer text)
-  static const size_t MAX_TEXT_LENGTH = 128;
-  char text_buffer_[MAX_TEXT_LENGTH];
-  bool text_dirty_{false};
+  // Frame scheduler state
+  bool frame_dirty_{false};  // Framebuffer or shimmer changed since the last push
+  uint32_t frame_interval_ms_{DISPLAY_FRAME_INTERVAL_MS};
+  uint32_t last_frame_time_{0};
+  DisplayFrameStats frame_stats_;
+  
+  // Time-sliced push of the rendered frame
+  uint32_t push_budget_us_{DISPLAY_PUSH_BUDGET_US};
+  bool push_pending_{false};
+  size_t push_board_{0};           // Board currently being sent
+  uint32_t frame_busy_us_{0};      // Render + I2C time of the frame in flight
+  uint32_t frame_sequence_{0};     // Last frame rendered
+  uint32_t completed_sequence_{0}; // Last frame fully pushed
+#ifdef USE_I2C_ARBITER
+  i2c_arbiter::I2CArbiter *arbiter_{nullptr};
+#endif
   
   // Scrolling state
   uint8_t scroll_mode_{SCROLL_AUTO};
@@ -69,25 +147,38 @@ class RetroTextDisplay : public Component {
   uint32_t scroll_start_delay_ms_{1000};  // Wait 1s before starting to scroll
   uint32_t text_set_time_{0};   // When text was last changed
   uint32_t last_scroll_time_{0};
-  int scroll_position_{0};
-  size_t text_length_{0};
   uint8_t stationary_prefix_chars_{0};  // Number of chars at start that don't scroll
+  bool smooth_scroll_{false};           // 1-pixel steps instead of whole characters
+  
+  // Scroll strip: text after the prefix plus the " * " separator, rasterized
+  // once per set_text() as glyph columns. Scrolling slides a window over it.
+  std::array<uint8_t, (MAX_TEXT_LENGTH + 3) * GLYPH_WIDTH> scroll_strip_;
+  uint16_t strip_columns_{0};  // One full scroll cycle
+  uint16_t scroll_glyphs_{0};  // Glyphs in the strip before the separator
+  uint16_t scroll_offset_{0};  // Window start in strip columns
   
   // Shimmer effect state
   bool shimmer_enabled_{false};
-  float shimmer_phase_{0.0f};  // Animation phase (0.0 to 2*PI)
+  uint8_t shimmer_phase_{0};  // Wave phase in 1/256 cycle, derived from elapsed time
+  uint32_t shimmer_start_time_{0};
+  uint32_t last_shimmer_frame_{0};
+  uint32_t shimmer_interval_ms_{1000 / SHIMMER_DEFAULT_FPS};
   
   // Internal methods
   bool initialize_boards_();
+  void invalidate_frame_();
+  void render_frame_();
+  void service_push_();
+  bool push_step_();
+  void note_blocking_(uint32_t elapsed_us);
+  void complete_push_();
+  void decode_text_(const char *text);
   void render_text_();
+  void build_scroll_strip_();
+  bool should_scroll_() const;
   void update_display_();
-  void set_pixel_(int x, int y, uint8_t brightness);
+  void clear_framebuffer_();
   void draw_character_(uint8_t glyph_index, int x_offset, uint8_t brightness);
-  uint8_t get_glyph_row_(uint8_t glyph_index, int row) const;
-  
-  // Coordinate helpers
-  int get_board_for_x_(int x) const;
-  int get_local_x_(int x) const;
 };
 
 }  // namespace retrotext_display
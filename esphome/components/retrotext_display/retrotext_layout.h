@@ -0,0 +1,66 @@
+/**
+ * RetroText Pixel Layout
+ *
+ * Compile-time table mapping each logical display pixel (72×6, origin top-left)
+ * to the IS31FL3737 board and PWM register that drives it.
+ *
+ * The mapping combines (see DisplayManager.cpp in the legacy firmware):
+ * - Display mounted upside down: X and Y are both flipped
+ * - 24 columns per board, boards left to right
+ * - Characters 0-2 of a board use SW1-6, characters 3-5 use SW7-12
+ * - IS31FL3737 CS7-12 register remap (is31fl3737_pwm_register)
+ */
+#pragma once
+
+#include "is31fl3737_registers.h"
+#include <cstdint>
+
+namespace esphome {
+namespace retrotext_display {
+
+constexpr uint8_t DISPLAY_WIDTH = 72;
+constexpr uint8_t DISPLAY_HEIGHT = 6;
+constexpr uint8_t DISPLAY_BOARDS = 3;
+constexpr uint8_t BOARD_WIDTH = DISPLAY_WIDTH / DISPLAY_BOARDS;  // 24 columns
+constexpr uint16_t DISPLAY_PIXELS = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+
+struct PixelRegister {
+  uint8_t board;  // 0-2, left to right as listed in board_addresses
+  uint8_t reg;    // PWM register address on that board
+};
+
+constexpr PixelRegister compute_pixel_register(uint8_t x, uint8_t y) {
+  // Flip both axes (display is mounted upside down)
+  uint8_t screen_x = DISPLAY_WIDTH - 1 - x;
+  uint8_t screen_y = DISPLAY_HEIGHT - 1 - y;
+
+  uint8_t local_x = screen_x % BOARD_WIDTH;
+  uint8_t char_index = local_x / 4;  // Character 0-5 within board
+  uint8_t char_pixel_x = local_x % 4;
+
+  // Characters 0,1,2 → SW1-6; characters 3,4,5 → SW7-12 (both on CS1-12)
+  uint8_t physical_x = (char_index % 3) * 4 + char_pixel_x;
+  uint8_t physical_y = char_index < 3 ? screen_y : screen_y + 6;
+
+  return PixelRegister{static_cast<uint8_t>(screen_x / BOARD_WIDTH), is31fl3737_pwm_register(physical_x, physical_y)};
+}
+
+// Column-major, indexed by x * DISPLAY_HEIGHT + y (same order as the display framebuffer)
+struct PixelMap {
+  PixelRegister pixels[DISPLAY_PIXELS];
+};
+
+constexpr PixelMap build_pixel_map() {
+  PixelMap map{};
+  for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+    for (uint8_t y = 0; y < DISPLAY_HEIGHT; y++) {
+      map.pixels[x * DISPLAY_HEIGHT + y] = compute_pixel_register(x, y);
+    }
+  }
+  return map;
+}
+
+static constexpr PixelMap PIXEL_MAP = build_pixel_map();
+
+}  // namespace retrotext_display
+}  // namespace esphome
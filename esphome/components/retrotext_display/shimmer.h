@@ -0,0 +1,57 @@
+/**
+ * Shimmer effect for the RetroText display
+ *
+ * Fixed-point replacement for the per-pixel sinf() wave: a diagonal sine wave
+ * (2 periods across the display, 1/12 period shift per row) modulating lit
+ * pixels between 0.6× and 1.4× brightness. Angles are in 1/256 cycle units.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace retrotext_display {
+
+// One full cycle of sin(), scaled to ±127
+static const int8_t SHIMMER_SINE[256] = {
+       0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+      49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+      90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+     117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+     127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+     117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+      90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+      49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+       0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+     -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+     -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+     -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+     -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+// Time for the wave to travel one period (about 0.15 rad per 16 ms loop, as before)
+constexpr uint32_t SHIMMER_CYCLE_MS = 670;
+
+// Default frame clock for the animation
+constexpr uint8_t SHIMMER_DEFAULT_FPS = 30;
+
+// Wave phase (1/256 cycle) after elapsed_ms of shimmering
+inline uint8_t shimmer_phase_at(uint32_t elapsed_ms) {
+  return static_cast<uint8_t>((elapsed_ms % SHIMMER_CYCLE_MS) * 256 / SHIMMER_CYCLE_MS);
+}
+
+// Brightness of a lit pixel at logical (x, y) for the given wave phase
+inline uint8_t shimmer_pixel(uint8_t brightness, uint8_t x, uint8_t y, uint8_t phase) {
+  // 2 periods across 72 columns = 512/72 steps per column; PI/6 per row = 256/12 steps
+  uint8_t angle = static_cast<uint8_t>(x * 64 / 9 + y * 64 / 3 - phase);
+  // Gain in 1/256 units: 256 ± 0.4 × 256
+  int32_t gain = 256 + (SHIMMER_SINE[angle] * 102) / 127;
+  int32_t value = (brightness * gain) >> 8;
+  return value > 255 ? 255 : static_cast<uint8_t>(value);
+}
+
+}  // namespace retrotext_display
+}  // namespace esphome
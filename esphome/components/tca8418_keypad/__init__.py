@@ -7,12 +7,15 @@ Based on Adafruit_TCA8418 library, adapted for ESPHome.
 """
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import i2c
-from esphome.const import CONF_ID, CONF_TRIGGER_ID
-from esphome import automation
+from esphome.components import i2c, i2c_arbiter
+from esphome.const import CONF_ID, CONF_INTERRUPT_PIN, CONF_PLATFORM, CONF_TRIGGER_ID
+from esphome.core import CORE
+from esphome import automation, pins
 
 # Component will be in tca8418_keypad namespace
 DEPENDENCIES = ["i2c"]
+# FIFO overflow counter is exposed through the sensor platform
+AUTO_LOAD = ["sensor"]
 
 tca8418_keypad_ns = cg.esphome_ns.namespace("tca8418_keypad")
 TCA8418Component = tca8418_keypad_ns.class_(
@@ -32,6 +35,13 @@ CONF_ROWS = "rows"
 CONF_COLUMNS = "columns"
 CONF_ON_KEY_PRESS = "on_key_press"
 CONF_ON_KEY_RELEASE = "on_key_release"
+CONF_BURST_DRAIN = "burst_drain"
+# Binary sensor key position
+CONF_ROW = "row"
+CONF_COLUMN = "column"
+
+# Keys in a full 8x10 matrix (TCA8418_KEY_COUNT)
+KEY_COUNT = 80
 
 # Configuration schema with triggers
 CONFIG_SCHEMA = (
@@ -39,7 +49,13 @@ CONFIG_SCHEMA = (
         {
             cv.GenerateID(): cv.declare_id(TCA8418Component),
             cv.Optional(CONF_ROWS, default=8): cv.int_range(min=1, max=8),
+            # Event reads cut in between the arbiter's bulk chunks
+            cv.Optional(i2c_arbiter.CONF_I2C_ARBITER_ID): cv.use_id(i2c_arbiter.I2CArbiter),
             cv.Optional(CONF_COLUMNS, default=10): cv.int_range(min=1, max=10),
+            # /INT is active low and open drain: set pullup unless the board has one
+            cv.Optional(CONF_INTERRUPT_PIN): pins.internal_gpio_input_pin_schema,
+            # Read the whole event FIFO in one transaction instead of one per event
+            cv.Optional(CONF_BURST_DRAIN, default=True): cv.boolean,
             cv.Optional(CONF_ON_KEY_PRESS): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(KeyPressTrigger),
@@ -57,14 +73,46 @@ CONFIG_SCHEMA = (
 )
 
 
+def build_key_sensor_map():
+    """Map each key (row * 10 + col) to 1 + its binary sensor slot, 0 for none.
+
+    Slots follow binary_sensor config order; sensors sharing a key share a slot.
+    """
+    key_sensor_map = [0] * KEY_COUNT
+    slots = 0
+    for conf in CORE.config.get("binary_sensor", []):
+        if conf.get(CONF_PLATFORM) != "tca8418_keypad":
+            continue
+        key = conf[CONF_ROW] * 10 + conf[CONF_COLUMN]
+        if key_sensor_map[key] == 0:
+            slots += 1
+            key_sensor_map[key] = slots
+    return key_sensor_map
+
+
 async def to_code(config):
     """Generate C++ code for the component."""
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await i2c.register_i2c_device(var, config)
+    await i2c_arbiter.register_arbiter_client(var, config)
     
     # Set matrix configuration
     cg.add(var.set_matrix_size(config[CONF_ROWS], config[CONF_COLUMNS]))
+    cg.add(var.set_burst_drain(config[CONF_BURST_DRAIN]))
+    
+    # Interrupt mode: only read the FIFO when /INT is asserted
+    if CONF_INTERRUPT_PIN in config:
+        pin = await cg.gpio_pin_expression(config[CONF_INTERRUPT_PIN])
+        cg.add(var.set_interrupt_pin(pin))
+    
+    # Key -> binary sensor slot table, compiled into flash
+    key_sensor_map = build_key_sensor_map()
+    if any(key_sensor_map):
+        cg.add_define(
+            "TCA8418_KEY_SENSOR_MAP",
+            cg.RawExpression("{" + ", ".join(str(entry) for entry in key_sensor_map) + "}"),
+        )
     
     # Register on_key_press triggers
     for conf in config.get(CONF_ON_KEY_PRESS, []):
@@ -6,13 +6,11 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import binary_sensor
 from esphome.const import CONF_ID
-from . import tca8418_keypad_ns, TCA8418Component
+from . import tca8418_keypad_ns, TCA8418Component, CONF_ROW, CONF_COLUMN
 
 DEPENDENCIES = ["tca8418_keypad"]
 
 CONF_TCA8418_KEYPAD_ID = "tca8418_keypad_id"
-CONF_ROW = "row"
-CONF_COLUMN = "column"
 
 TCA8418BinarySensor = tca8418_keypad_ns.class_(
     "TCA8418BinarySensor", binary_sensor.BinarySensor, cg.Component
@@ -0,0 +1,86 @@
+/**
+ * Timestamped key event queue
+ *
+ * Single-producer single-consumer ring buffer between the keypad and one
+ * consumer. The keypad pushes each event with a micros() stamp from the
+ * FIFO drain that read it; the consumer pops them whenever its own loop
+ * runs, so a slow consumer never holds up the next FIFO drain.
+ *
+ * Only the producer stores head_ and only the consumer stores tail_, so no
+ * lock is needed (the release/acquire pairs publish the slot contents).
+ * When the ring is full the new event is dropped and counted: the producer
+ * can't discard the oldest entry without racing the consumer.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace tca8418_keypad {
+
+// Slots per queue (power of two); three full chip FIFOs
+constexpr uint16_t KEY_EVENT_QUEUE_SIZE = 32;
+static_assert((KEY_EVENT_QUEUE_SIZE & (KEY_EVENT_QUEUE_SIZE - 1)) == 0, "queue size must be a power of two");
+
+struct TimedKeyEvent {
+  // micros() of the drain that read it; earlier events of one drain are
+  // spread back evenly since the FIFO was last empty (the chip keeps no times)
+  uint32_t timestamp_us;
+  uint8_t row;
+  uint8_t col;
+  bool press;
+};
+
+class KeyEventQueue {
+ public:
+  // Producer side: false (and counted as dropped) when full
+  bool push(const TimedKeyEvent &event) {
+    uint16_t head = this->head_.load(std::memory_order_relaxed);
+    uint16_t used = static_cast<uint16_t>(head - this->tail_.load(std::memory_order_acquire));
+    if (used >= KEY_EVENT_QUEUE_SIZE) {
+      this->dropped_++;
+      return false;
+    }
+    this->slots_[head & (KEY_EVENT_QUEUE_SIZE - 1)] = event;
+    this->head_.store(static_cast<uint16_t>(head + 1), std::memory_order_release);
+    this->pushed_++;
+    if (used + 1 > this->high_water_) {
+      this->high_water_ = used + 1;
+    }
+    return true;
+  }
+
+  // Consumer side: false when empty
+  bool pop(TimedKeyEvent *event) {
+    uint16_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *event = this->slots_[tail & (KEY_EVENT_QUEUE_SIZE - 1)];
+    this->tail_.store(static_cast<uint16_t>(tail + 1), std::memory_order_release);
+    return true;
+  }
+
+  uint16_t size() const {
+    return static_cast<uint16_t>(this->head_.load(std::memory_order_acquire) -
+                                 this->tail_.load(std::memory_order_acquire));
+  }
+  bool empty() const { return this->size() == 0; }
+
+  // Overflow accounting (written by the producer only)
+  uint32_t get_pushed() const { return this->pushed_; }
+  uint32_t get_dropped() const { return this->dropped_; }
+  uint16_t get_high_water() const { return this->high_water_; }
+
+ protected:
+  TimedKeyEvent slots_[KEY_EVENT_QUEUE_SIZE]{};
+  std::atomic<uint16_t> head_{0};  // Next slot to write (free-running)
+  std::atomic<uint16_t> tail_{0};  // Next slot to read (free-running)
+  uint32_t pushed_{0};
+  uint32_t dropped_{0};
+  uint16_t high_water_{0};  // Most events ever waiting at once
+};
+
+}  // namespace tca8418_keypad
+}  // namespace esphome
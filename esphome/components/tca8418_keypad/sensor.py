@@ -0,0 +1,35 @@
+"""Sensor Platform for TCA8418 Keypad.
+
+Exposes event FIFO diagnostics.
+"""
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, STATE_CLASS_TOTAL_INCREASING
+from . import TCA8418Component
+
+DEPENDENCIES = ["tca8418_keypad"]
+
+CONF_TCA8418_KEYPAD_ID = "tca8418_keypad_id"
+CONF_FIFO_OVERFLOWS = "fifo_overflows"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_TCA8418_KEYPAD_ID): cv.use_id(TCA8418Component),
+        # Times the 10-event FIFO overflowed and dropped key events
+        cv.Optional(CONF_FIFO_OVERFLOWS): sensor.sensor_schema(
+            icon="mdi:tray-alert",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    """Generate code for the FIFO sensors."""
+    parent = await cg.get_variable(config[CONF_TCA8418_KEYPAD_ID])
+    if CONF_FIFO_OVERFLOWS in config:
+        sens = await sensor.new_sensor(config[CONF_FIFO_OVERFLOWS])
+        cg.add(parent.set_fifo_overflow_sensor(sens))
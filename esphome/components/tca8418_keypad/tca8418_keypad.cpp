@@ -35,36 +35,194 @@ void TCA8418Component::setup() {
   // Flush any pending events from before initialization
   this->flush_events_();
   
+  if (this->interrupt_pin_ != nullptr) {
+    this->interrupt_pin_->setup();
+    this->interrupt_pin_->attach_interrupt(&TCA8418Component::gpio_intr_, this, gpio::INTERRUPT_FALLING_EDGE);
+    // A key pressed since the flush may already hold /INT low
+    this->interrupt_pending_ = !this->interrupt_pin_->digital_read();
+    this->last_event_read_ms_ = millis();
+  }
+  
+#ifdef USE_I2C_ARBITER
+  if (this->arbiter_ != nullptr) {
+    this->arbiter_->add_urgent_poller([this]() { this->service_events_(); });
+  }
+#endif
+  
   // Device is configured and ready
+  if (this->fifo_overflow_sensor_ != nullptr) {
+    this->fifo_overflow_sensor_->publish_state(0);
+  }
+  
   ESP_LOGI(TAG, "TCA8418 initialization complete");
 }
 
 void TCA8418Component::loop() {
-  // Poll for key events
+  this->service_events_();
+  this->dispatch_events_();
+}
+
+void IRAM_ATTR TCA8418Component::gpio_intr_(TCA8418Component *arg) {
+  arg->interrupt_pending_ = true;
+  arg->interrupt_count_++;
+}
+
+void TCA8418Component::service_events_() {
+  if (this->interrupt_pin_ == nullptr) {
+    this->poll_events_();
+    return;
+  }
+  
+  // The chip keeps /INT low while K_INT is set, so check the level as well as
+  // the edge flag: events queued during the last drain produce no new edge
+  uint32_t now = millis();
+  bool asserted = this->interrupt_pending_ || !this->interrupt_pin_->digital_read();
+  bool safety_poll = !asserted && now - this->last_event_read_ms_ >= TCA8418_SAFETY_POLL_MS;
+  if (!asserted && !safety_poll) {
+    // /INT is released, so nothing is queued on the chip yet
+    this->fifo_empty_us_ = micros();
+    return;
+  }
+  
+  // Clear the flag before draining so an edge during the drain isn't lost
+  this->interrupt_pending_ = false;
+  this->last_event_read_ms_ = now;
+  if (safety_poll) {
+    this->safety_polls_++;
+  } else {
+    this->event_reads_++;
+  }
+  
+  uint8_t event_count = this->poll_events_();
+  if (safety_poll && event_count > 0) {
+    ESP_LOGW(TAG, "Safety poll found %d events without an interrupt - check the interrupt pin wiring", event_count);
+  }
+  this->clear_interrupts_();
+}
+
+bool TCA8418Component::clear_interrupts_() {
+  // Write-1-to-clear; K_INT is set again right away if the FIFO still holds
+  // events, keeping /INT asserted for the next loop. OVR_FLOW_INT is left for
+  // check_overflow_() to count.
+  return this->write_register_(TCA8418_REG_INT_STAT, TCA8418_REG_STAT_K_INT | TCA8418_REG_STAT_GPI_INT);
+}
+
+uint8_t TCA8418Component::poll_events_() {
   // Check if any events are available in the FIFO
   uint8_t event_count = this->available_events_();
+  if (event_count == 0) {
+    this->fifo_empty_us_ = micros();
+    return 0;
+  }
+  if (event_count > TCA8418_FIFO_SIZE) {
+    event_count = TCA8418_FIFO_SIZE;
+  }
   
-  if (event_count > 0) {
-    // Process ALL available events in FIFO (up to 10, the FIFO size)
-    // Don't limit to fewer, or we risk losing encoder events during fast rotation
-    for (uint8_t i = 0; i < event_count && i < 10; i++) {
-      uint8_t event = 0;
-      if (this->read_event_(&event)) {
-        this->process_event_(event);
-      }
+  // Drain ALL available events before anything else: the chip keeps
+  // queueing encoder steps meanwhile
+  uint8_t raw[TCA8418_FIFO_SIZE];
+  uint8_t drained = this->read_events_(raw, event_count);
+  uint32_t now = micros();
+  this->drains_++;
+  this->events_drained_ += drained;
+  
+  // Overflow can only happen while the FIFO is full, and OVR_FLOW_INT stays
+  // set until cleared, so this also catches one that raced the last drain
+  if (event_count == TCA8418_FIFO_SIZE) {
+    this->check_overflow_();
+  }
+  
+  TimedKeyEvent batch[TCA8418_FIFO_SIZE];
+  uint8_t batch_size = 0;
+  for (uint8_t i = 0; i < drained; i++) {
+    if (raw[i] == 0) {
+      continue;  // FIFO ran dry early
     }
-    
-    // If FIFO was full (10 events), warn about potential overflow
-    if (event_count >= 10) {
-      ESP_LOGW(TAG, "FIFO was full (%d events) - some events may have been lost!", event_count);
+    TimedKeyEvent &event = batch[batch_size++];
+    this->decode_key_event_(raw[i], &event.press, &event.row, &event.col);
+  }
+  
+  // The chip doesn't timestamp events; all we know is that they arrived, in
+  // FIFO order, after the FIFO was last seen empty and before this drain.
+  // Spread them evenly over that window, the newest at the drain time, so
+  // a fast encoder spin keeps its rate instead of landing in one instant.
+  uint32_t spacing = batch_size > 0 ? (now - this->fifo_empty_us_) / batch_size : 0;
+  for (uint8_t i = 0; i < batch_size; i++) {
+    batch[i].timestamp_us = now - spacing * (batch_size - 1 - i);
+  }
+  this->fifo_empty_us_ = now;
+  
+  // Queue only: triggers and consumers run from their own loops, so a slow
+  // one (an HA service call) never delays the next drain
+  for (uint8_t i = 0; i < batch_size; i++) {
+    if (!this->dispatch_queue_.push(batch[i])) {
+      ESP_LOGW(TAG, "Key event queue full - dropped row=%d, col=%d", batch[i].row, batch[i].col);
+    }
+    for (auto *queue : this->event_queues_) {
+      if (!queue->push(batch[i])) {
+        ESP_LOGW(TAG, "Consumer key event queue full - dropped row=%d, col=%d", batch[i].row, batch[i].col);
+      }
     }
   }
+  return event_count;
+}
+
+void TCA8418Component::dispatch_events_() {
+  TimedKeyEvent event;
+  while (this->dispatch_queue_.pop(&event)) {
+    this->process_event_(event);
+  }
+}
+
+uint8_t TCA8418Component::read_events_(uint8_t *events, uint8_t count) {
+  if (this->burst_drain_) {
+    // CFG.AI is left clear, so every byte of a burst read of KEY_EVENT_A
+    // pops the next event: one transaction for the whole batch
+    return this->read_register(TCA8418_REG_KEY_EVENT_A, events, count) == i2c::ERROR_OK ? count : 0;
+  }
+  uint8_t read = 0;
+  while (read < count && this->read_event_(&events[read])) {
+    read++;
+  }
+  return read;
+}
+
+void TCA8418Component::check_overflow_() {
+  uint8_t int_stat = 0;
+  if (!this->read_register_(TCA8418_REG_INT_STAT, &int_stat) || !(int_stat & TCA8418_REG_STAT_OVR_FLOW_INT)) {
+    return;
+  }
+  this->write_register_(TCA8418_REG_INT_STAT, TCA8418_REG_STAT_OVR_FLOW_INT);
+  this->fifo_overflows_++;
+  ESP_LOGW(TAG, "Event FIFO overflowed - key events were lost (%u overflows since boot)",
+           (unsigned) this->fifo_overflows_);
+  if (this->fifo_overflow_sensor_ != nullptr) {
+    this->fifo_overflow_sensor_->publish_state(this->fifo_overflows_);
+  }
 }
 
 void TCA8418Component::dump_config() {
   ESP_LOGCONFIG(TAG, "TCA8418 Keypad Matrix Controller:");
   LOG_I2C_DEVICE(this);
   ESP_LOGCONFIG(TAG, "  Matrix Size: %d rows x %d columns", this->rows_, this->columns_);
+  if (this->interrupt_pin_ != nullptr) {
+    LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
+    ESP_LOGCONFIG(TAG, "  Safety Poll: every %u ms", (unsigned) TCA8418_SAFETY_POLL_MS);
+    ESP_LOGCONFIG(TAG, "  Interrupts: %u, event reads: %u, safety polls: %u", (unsigned) this->interrupt_count_,
+                  (unsigned) this->event_reads_, (unsigned) this->safety_polls_);
+  } else {
+    ESP_LOGCONFIG(TAG, "  Mode: polling every loop");
+  }
+  ESP_LOGCONFIG(TAG, "  FIFO Drain: %s", this->burst_drain_ ? "burst" : "one event per read");
+  ESP_LOGCONFIG(TAG, "  Events: %u in %u drains, %u FIFO overflows", (unsigned) this->events_drained_,
+                (unsigned) this->drains_, (unsigned) this->fifo_overflows_);
+  ESP_LOGCONFIG(TAG, "  Event Queue: %u dropped, peak %u/%u; %u consumer queues",
+                (unsigned) this->dispatch_queue_.get_dropped(), this->dispatch_queue_.get_high_water(),
+                KEY_EVENT_QUEUE_SIZE, (unsigned) this->event_queues_.size());
+  for (auto *queue : this->event_queues_) {
+    ESP_LOGCONFIG(TAG, "    Consumer: %u dropped, peak %u/%u", (unsigned) queue->get_dropped(),
+                  queue->get_high_water(), KEY_EVENT_QUEUE_SIZE);
+  }
   
   if (this->is_failed()) {
     ESP_LOGE(TAG, "  Communication with TCA8418 failed!");
@@ -99,8 +257,40 @@ void TCA8418Component::add_key_release_trigger(KeyReleaseTrigger *trigger) {
 
 void TCA8418Component::register_key_sensor(uint8_t row, uint8_t col, binary_sensor::BinarySensor *sensor) {
   uint8_t key = this->make_sensor_key_(row, col);
-  this->key_sensors_[key] = sensor;
-  ESP_LOGD(TAG, "Registered binary sensor for row=%d, col=%d (key=%d)", row, col, key);
+  if (row >= 8 || col >= 10) {
+    ESP_LOGW(TAG, "Binary sensor outside the 8x10 matrix: row=%d, col=%d", row, col);
+    return;
+  }
+#ifndef TCA8418_KEY_SENSOR_MAP
+  if (this->key_sensor_map_[key] == 0) {
+    this->key_sensors_.push_back(nullptr);
+    this->key_sensor_map_[key] = this->key_sensors_.size();
+  }
+#endif
+  uint8_t entry = this->key_sensor_entry_(key);
+  if (entry == 0) {
+    ESP_LOGW(TAG, "No generated slot for binary sensor row=%d, col=%d", row, col);
+    return;
+  }
+  if (this->key_sensors_.size() < entry) {
+    this->key_sensors_.resize(entry, nullptr);
+  }
+  // A second sensor on the same key replaces the first
+  this->key_sensors_[entry - 1] = sensor;
+  ESP_LOGD(TAG, "Registered binary sensor for row=%d, col=%d (key=%d, slot=%d)", row, col, key, entry - 1);
+}
+
+#ifdef TCA8418_KEY_SENSOR_MAP
+// Generated from the binary_sensor config: 1 + sensor slot per key, 0 for none
+static constexpr uint8_t KEY_SENSOR_MAP[TCA8418_KEY_COUNT] = TCA8418_KEY_SENSOR_MAP;
+#endif
+
+uint8_t TCA8418Component::key_sensor_entry_(uint8_t key) const {
+#ifdef TCA8418_KEY_SENSOR_MAP
+  return KEY_SENSOR_MAP[key];
+#else
+  return this->key_sensor_map_[key];
+#endif
 }
 
 // I2C Communication Methods
@@ -214,6 +404,11 @@ bool TCA8418Component::configure_matrix_() {
   
   // Enable key event interrupts
   uint8_t cfg = TCA8418_REG_CFG_KE_IEN;  // Enable key event interrupts
+  if (this->interrupt_pin_ != nullptr) {
+    // Pulse /INT high for 50 us when it is cleared with events still
+    // pending, so the falling edge fires the ISR again
+    cfg |= TCA8418_REG_CFG_INT_CFG;
+  }
   if (!this->write_register_(TCA8418_REG_CFG, cfg)) {
     ESP_LOGE(TAG, "Failed to enable key event interrupts");
     return false;
@@ -238,8 +433,9 @@ bool TCA8418Component::flush_events_() {
     count++;
   }
   
-  // Clear interrupt status bits
-  if (!this->write_register_(TCA8418_REG_INT_STAT, 0x03)) {
+  // Clear interrupt status bits, including an overflow from before boot
+  if (!this->write_register_(TCA8418_REG_INT_STAT, TCA8418_REG_STAT_K_INT | TCA8418_REG_STAT_GPI_INT |
+                                                       TCA8418_REG_STAT_OVR_FLOW_INT)) {
     ESP_LOGW(TAG, "Failed to clear interrupt status");
     return false;
   }
@@ -270,33 +466,23 @@ bool TCA8418Component::read_event_(uint8_t *event) {
   return this->read_register_(TCA8418_REG_KEY_EVENT_A, event);
 }
 
-void TCA8418Component::process_event_(uint8_t event) {
-  // Decode and log the event
-  if (event == 0) {
-    return;  // No event
-  }
-  
-  bool is_press = false;
-  uint8_t row = 0;
-  uint8_t col = 0;
-  
-  this->decode_key_event_(event, &is_press, &row, &col);
+void TCA8418Component::process_event_(const TimedKeyEvent &event) {
+  // Calculate key code (1-based: row * 10 + col + 1)
+  uint8_t key_code = (event.row * 10) + event.col + 1;
   
   // Log the key event
-  const char *action = is_press ? "PRESS" : "RELEASE";
-  ESP_LOGI(TAG, "Key %s: row=%d, col=%d (event=0x%02X)", action, row, col, event);
-  
-  // Calculate key code (1-based: row * 10 + col + 1)
-  uint8_t key_code = (row * 10) + col + 1;
+  const char *action = event.press ? "PRESS" : "RELEASE";
+  ESP_LOGI(TAG, "Key %s: row=%d, col=%d (event=0x%02X, queued %u us)", action, event.row, event.col,
+           key_code | (event.press ? 0x80 : 0), (unsigned) (micros() - event.timestamp_us));
   
   // Update binary sensor state
-  this->update_binary_sensor_(row, col, is_press);
+  this->update_binary_sensor_(event.row, event.col, event.press);
   
   // Fire ESPHome triggers
-  if (is_press) {
-    this->fire_key_press_triggers_(row, col, key_code);
+  if (event.press) {
+    this->fire_key_press_triggers_(event.row, event.col, key_code);
   } else {
-    this->fire_key_release_triggers_(row, col, key_code);
+    this->fire_key_release_triggers_(event.row, event.col, key_code);
   }
 }
 
@@ -357,10 +543,12 @@ void TCA8418Component::fire_key_release_triggers_(uint8_t row, uint8_t col, uint
 }
 
 void TCA8418Component::update_binary_sensor_(uint8_t row, uint8_t col, bool pressed) {
-  uint8_t key = this->make_sensor_key_(row, col);
-  auto it = this->key_sensors_.find(key);
-  if (it != this->key_sensors_.end()) {
-    it->second->publish_state(pressed);
+  if (row >= 8 || col >= 10) {
+    return;
+  }
+  uint8_t entry = this->key_sensor_entry_(this->make_sensor_key_(row, col));
+  if (entry != 0 && entry <= this->key_sensors_.size() && this->key_sensors_[entry - 1] != nullptr) {
+    this->key_sensors_[entry - 1]->publish_state(pressed);
   }
 }
 
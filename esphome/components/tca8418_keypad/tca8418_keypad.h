@@ -14,13 +14,30 @@
 #include "esphome/core/component.h"
 #include "esphome/components/i2c/i2c.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
+#include "esphome/components/sensor/sensor.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "key_event_queue.h"
 #include "tca8418_registers.h"
-#include <map>
+
+#ifdef USE_I2C_ARBITER
+#include "esphome/components/i2c_arbiter/i2c_arbiter.h"
+#endif
 
 namespace esphome {
 namespace tca8418_keypad {
 
+// With an interrupt pin the FIFO is still checked this often even when /INT
+// stays high, so a missed edge can't leave events stuck in the chip
+static const uint32_t TCA8418_SAFETY_POLL_MS = 1000;
+
+// Depth of the chip's key event FIFO
+static const uint8_t TCA8418_FIFO_SIZE = 10;
+
+// Keys in a full 8x10 matrix; key index is row * 10 + col
+static const uint8_t TCA8418_KEY_COUNT = 80;
+
 // Forward declarations
 class KeyPressTrigger;
 class KeyReleaseTrigger;
@@ -33,6 +50,16 @@ class TCA8418BinarySensor;
  * - Matrix keypad scanning (up to 8x10)
  * - Key event detection (press/release)
  * - ESPHome triggers for automations
+ *
+ * Without an interrupt pin the event counter is read every loop. With one,
+ * the /INT falling edge sets a flag from the ISR and the bus is only touched
+ * while /INT is asserted or on the slow safety poll.
+ *
+ * Events read from the chip are stamped and queued; triggers, callbacks and
+ * binary sensors run from loop(), and consumers with their own
+ * KeyEventQueue drain it from theirs. The chip keeps no times, so a stamp
+ * is the drain time, with earlier events of the same drain spread back
+ * over the time since the FIFO was last seen empty.
  */
 class TCA8418Component : public Component, public i2c::I2CDevice {
  public:
@@ -47,6 +74,14 @@ class TCA8418Component : public Component, public i2c::I2CDevice {
 
   // Configuration setters (called from Python codegen)
   void set_matrix_size(uint8_t rows, uint8_t columns);
+  void set_interrupt_pin(InternalGPIOPin *pin) { this->interrupt_pin_ = pin; }
+  // Read the whole FIFO in one transaction (false: one read per event)
+  void set_burst_drain(bool burst) { this->burst_drain_ = burst; }
+  void set_fifo_overflow_sensor(sensor::Sensor *sensor) { this->fifo_overflow_sensor_ = sensor; }
+#ifdef USE_I2C_ARBITER
+  // Event reads also run before each of the arbiter's bulk chunks
+  void set_i2c_arbiter(i2c_arbiter::I2CArbiter *arbiter) { this->arbiter_ = arbiter; }
+#endif
   
   // Trigger registration
   void add_key_press_trigger(KeyPressTrigger *trigger);
@@ -61,22 +96,64 @@ class TCA8418Component : public Component, public i2c::I2CDevice {
     this->key_release_callbacks_.push_back(std::move(callback));
   }
   
+  // Timestamped events for a consumer that drains them from its own loop
+  // (the queue must outlive the keypad; one consumer per queue)
+  void add_event_queue(KeyEventQueue *queue) { this->event_queues_.push_back(queue); }
+  const KeyEventQueue &get_dispatch_queue() const { return this->dispatch_queue_; }
+  
   // Binary sensor registration
   void register_key_sensor(uint8_t row, uint8_t col, binary_sensor::BinarySensor *sensor);
 
+  // Interrupt mode counters (for diagnostics and tests)
+  uint32_t get_interrupt_count() const { return this->interrupt_count_; }
+  uint32_t get_event_reads() const { return this->event_reads_; }
+  uint32_t get_safety_polls() const { return this->safety_polls_; }
+  // FIFO drain counters
+  uint32_t get_drains() const { return this->drains_; }
+  uint32_t get_events_drained() const { return this->events_drained_; }
+  uint32_t get_fifo_overflows() const { return this->fifo_overflows_; }
+
  protected:
   // Matrix configuration
   uint8_t rows_{8};
   uint8_t columns_{10};
   
+  // /INT (active low, open drain); nullptr polls every loop
+  InternalGPIOPin *interrupt_pin_{nullptr};
+  volatile bool interrupt_pending_{false};
+  volatile uint32_t interrupt_count_{0};
+  uint32_t last_event_read_ms_{0};
+  uint32_t fifo_empty_us_{0};  // micros() when the FIFO was last known empty
+  uint32_t event_reads_{0};   // Event counter reads triggered by /INT
+  uint32_t safety_polls_{0};  // Reads forced by the safety poll alone
+  
+  bool burst_drain_{true};
+  uint32_t drains_{0};
+  uint32_t events_drained_{0};
+  uint32_t fifo_overflows_{0};  // OVR_FLOW_INT seen set (each one lost one or more events)
+  sensor::Sensor *fifo_overflow_sensor_{nullptr};
+  
+  // Read events waiting for triggers/callbacks, and consumer queues
+  KeyEventQueue dispatch_queue_;
+  std::vector<KeyEventQueue *> event_queues_;
+  
   // Triggers
   std::vector<KeyPressTrigger *> key_press_triggers_;
   std::vector<KeyReleaseTrigger *> key_release_triggers_;
   std::vector<KeyCallback> key_press_callbacks_;
   std::vector<KeyCallback> key_release_callbacks_;
   
-  // Binary sensors (map of row*10+col to sensor)
-  std::map<uint8_t, binary_sensor::BinarySensor *> key_sensors_;
+  // Binary sensors by slot. Keys map to 1 + slot (0: no sensor) through
+  // TCA8418_KEY_SENSOR_MAP, generated from the binary_sensor config, or
+  // through key_sensor_map_ filled in as sensors register
+  std::vector<binary_sensor::BinarySensor *> key_sensors_;
+#ifndef TCA8418_KEY_SENSOR_MAP
+  uint8_t key_sensor_map_[TCA8418_KEY_COUNT]{};
+#endif
+  
+#ifdef USE_I2C_ARBITER
+  i2c_arbiter::I2CArbiter *arbiter_{nullptr};
+#endif
   
   // I2C register access methods (using ESPHome's I2CDevice)
   bool read_register_(uint8_t reg, uint8_t *value);
@@ -88,14 +165,22 @@ class TCA8418Component : public Component, public i2c::I2CDevice {
   bool flush_events_();
   
   // Event processing
+  static void gpio_intr_(TCA8418Component *arg);
+  void service_events_();
+  bool clear_interrupts_();
+  uint8_t poll_events_();
   uint8_t available_events_();
   bool read_event_(uint8_t *event);
-  void process_event_(uint8_t event);
+  uint8_t read_events_(uint8_t *events, uint8_t count);
+  void check_overflow_();
+  void dispatch_events_();
+  void process_event_(const TimedKeyEvent &event);
   void decode_key_event_(uint8_t event, bool *is_press, uint8_t *row, uint8_t *col);
   void fire_key_press_triggers_(uint8_t row, uint8_t col, uint8_t key);
   void fire_key_release_triggers_(uint8_t row, uint8_t col, uint8_t key);
   void update_binary_sensor_(uint8_t row, uint8_t col, bool pressed);
   uint8_t make_sensor_key_(uint8_t row, uint8_t col) const { return row * 10 + col; }
+  uint8_t key_sensor_entry_(uint8_t key) const;
 };
 
 // Trigger classes for automation
@@ -0,0 +1,34 @@
+/**
+ * Host stub for esphome/components/binary_sensor/binary_sensor.h
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace binary_sensor {
+
+class BinarySensor {
+ public:
+  virtual ~BinarySensor() = default;
+
+  void publish_state(bool state) {
+    this->state = state;
+    this->has_state_ = true;
+    this->publishes_++;
+  }
+  bool has_state() const { return this->has_state_; }
+  uint32_t publishes() const { return this->publishes_; }
+
+  bool state{false};
+
+ protected:
+  bool has_state_{false};
+  uint32_t publishes_{0};
+};
+
+}  // namespace binary_sensor
+
+#define LOG_BINARY_SENSOR(prefix, type, obj) ((void) (obj))
+
+}  // namespace esphome
@@ -0,0 +1,79 @@
+/**
+ * Host stub for esphome/components/i2c/i2c.h
+ *
+ * Mirrors the subset of the ESPHome I2C API used by the components, as of
+ * ESPHome 2025.12 (requirements.txt): buses implement the single
+ * write_readv() transaction, and everything else is a helper on top of it,
+ * so a register read is one transaction with a repeated start.
+ * Tests provide a concrete I2CBus (see test/support/i2c_sim).
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace i2c {
+
+enum ErrorCode {
+  NO_ERROR = 0,
+  ERROR_OK = 0,
+  ERROR_INVALID_ARGUMENT = 1,
+  ERROR_NOT_ACKNOWLEDGED = 2,
+  ERROR_TIMEOUT = 3,
+  ERROR_NOT_INITIALIZED = 4,
+  ERROR_TOO_LARGE = 5,
+  ERROR_UNKNOWN = 6,
+  ERROR_CRC = 7,
+};
+
+class I2CBus {
+ public:
+  virtual ~I2CBus() = default;
+
+  // Writes write_count bytes, then (after a repeated start) reads read_count;
+  // either side may be empty
+  virtual ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count,
+                                uint8_t *read_buffer, size_t read_count) = 0;
+
+  ErrorCode read(uint8_t address, uint8_t *buffer, size_t len) {
+    return this->write_readv(address, nullptr, 0, buffer, len);
+  }
+  ErrorCode write(uint8_t address, const uint8_t *buffer, size_t len) {
+    return this->write_readv(address, buffer, len, nullptr, 0);
+  }
+};
+
+class I2CDevice {
+ public:
+  I2CDevice() = default;
+  void set_i2c_address(uint8_t address) { this->address_ = address; }
+  void set_i2c_bus(I2CBus *bus) { this->bus_ = bus; }
+
+  ErrorCode read(uint8_t *data, size_t len) const { return this->bus_->read(this->address_, data, len); }
+  ErrorCode write(const uint8_t *data, size_t len) const { return this->bus_->write(this->address_, data, len); }
+  ErrorCode write_read(const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                       size_t read_count) const {
+    return this->bus_->write_readv(this->address_, write_buffer, write_count, read_buffer, read_count);
+  }
+  ErrorCode read_register(uint8_t a_register, uint8_t *data, size_t len) const {
+    return this->write_read(&a_register, 1, data, len);
+  }
+  ErrorCode write_register(uint8_t a_register, const uint8_t *data, size_t len) const {
+    std::vector<uint8_t> buffer(len + 1);
+    buffer[0] = a_register;
+    std::copy(data, data + len, buffer.begin() + 1);
+    return this->write(buffer.data(), buffer.size());
+  }
+
+ protected:
+  uint8_t address_{0x00};
+  I2CBus *bus_{nullptr};
+};
+
+#define LOG_I2C_DEVICE(this) ((void) (this))
+
+}  // namespace i2c
+}  // namespace esphome
@@ -0,0 +1,33 @@
+/**
+ * Host stub for esphome/components/sensor/sensor.h
+ */
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace sensor {
+
+class Sensor {
+ public:
+  virtual ~Sensor() = default;
+
+  void publish_state(float state) {
+    this->state = state;
+    this->publishes_++;
+  }
+  bool has_state() const { return this->publishes_ > 0; }
+  uint32_t publishes() const { return this->publishes_; }
+
+  float state{NAN};
+
+ protected:
+  uint32_t publishes_{0};
+};
+
+}  // namespace sensor
+
+#define LOG_SENSOR(prefix, type, obj) ((void) (obj))
+
+}  // namespace esphome
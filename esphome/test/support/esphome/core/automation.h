@@ -0,0 +1,29 @@
+/**
+ * Host stub for esphome/core/automation.h
+ *
+ * Triggers record how often they fired and the last arguments, so tests
+ * can check automations without the action framework.
+ */
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+
+namespace esphome {
+
+template<typename... Ts> class Trigger {
+ public:
+  void trigger(Ts... x) {
+    this->fired_++;
+    this->last_ = std::make_tuple(x...);
+  }
+
+  uint32_t fired() const { return this->fired_; }
+  const std::tuple<Ts...> &last() const { return this->last_; }
+
+ protected:
+  uint32_t fired_{0};
+  std::tuple<Ts...> last_{};
+};
+
+}  // namespace esphome
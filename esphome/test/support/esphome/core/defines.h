@@ -0,0 +1,7 @@
+/**
+ * Host stub for esphome/core/defines.h
+ *
+ * ESPHome generates this header from the YAML config. Host builds take their
+ * feature flags from build_flags instead, so it is empty here.
+ */
+#pragma once
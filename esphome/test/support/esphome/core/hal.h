@@ -0,0 +1,31 @@
+/**
+ * Host stub for esphome/core/hal.h
+ *
+ * Time is driven by the test through host_time::advance_us() so that
+ * frame clocks and timeouts are deterministic.
+ */
+#pragma once
+
+#include <cstdint>
+#include "esphome/core/gpio.h"
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+namespace esphome {
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+}  // namespace esphome
+
+namespace host_time {
+
+void advance_us(uint32_t us);
+void advance_ms(uint32_t ms);
+void reset();
+
+}  // namespace host_time
@@ -0,0 +1,14 @@
+/**
+ * Host stub for esphome/core/helpers.h
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "esphome/core/hal.h"
+
+namespace esphome {
+
+inline void delay_microseconds_safe(uint32_t us) { delayMicroseconds(us); }
+
+}  // namespace esphome
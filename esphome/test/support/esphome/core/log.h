@@ -0,0 +1,23 @@
+/**
+ * Host stub for esphome/core/log.h
+ *
+ * Logging is compiled out in native tests. Define HOST_LOG to print
+ * messages to stdout when debugging a test.
+ */
+#pragma once
+
+#include <cstdio>
+
+#ifdef HOST_LOG
+#define ESP_HOST_LOG_(level, tag, fmt, ...) printf("[%s][%s] " fmt "\n", level, tag, ##__VA_ARGS__)
+#else
+#define ESP_HOST_LOG_(level, tag, fmt, ...) ((void) (tag))
+#endif
+
+#define ESP_LOGE(tag, ...) ESP_HOST_LOG_("E", tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ESP_HOST_LOG_("W", tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ESP_HOST_LOG_("I", tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) ESP_HOST_LOG_("D", tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) ESP_HOST_LOG_("V", tag, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) ESP_HOST_LOG_("VV", tag, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) ESP_HOST_LOG_("C", tag, __VA_ARGS__)
@@ -0,0 +1,27 @@
+/**
+ * Deterministic clock for the host stubs of esphome/core/hal.h
+ */
+#include "esphome/core/hal.h"
+
+namespace {
+
+uint64_t now_us = 0;
+
+}  // namespace
+
+namespace esphome {
+
+uint32_t millis() { return static_cast<uint32_t>(now_us / 1000); }
+uint32_t micros() { return static_cast<uint32_t>(now_us); }
+void delay(uint32_t ms) { now_us += static_cast<uint64_t>(ms) * 1000; }
+void delayMicroseconds(uint32_t us) { now_us += us; }
+
+}  // namespace esphome
+
+namespace host_time {
+
+void advance_us(uint32_t us) { now_us += us; }
+void advance_ms(uint32_t ms) { now_us += static_cast<uint64_t>(ms) * 1000; }
+void reset() { now_us = 0; }
+
+}  // namespace host_time
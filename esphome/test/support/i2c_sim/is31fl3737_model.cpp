@@ -0,0 +1,184 @@
+/**
+ * Register model of the IS31FL3737
+ */
+#include "is31fl3737_model.h"
+#include "esphome/core/hal.h"
+
+namespace i2c_sim {
+
+namespace {
+
+constexpr uint8_t REG_COMMAND = 0xFD;
+constexpr uint8_t REG_UNLOCK = 0xFE;
+constexpr uint8_t UNLOCK_VALUE = 0xC5;
+constexpr uint8_t REG_RESET = 0x11;
+constexpr uint8_t REG_ABM1 = 0x02;
+constexpr uint8_t REG_TIME_UPDATE = 0x0E;
+
+constexpr uint32_t ramp_ms(uint8_t code) { return 210u << code; }
+constexpr uint32_t hold_ms(uint8_t code) { return code == 0 ? 0 : 210u << (code - 1); }
+
+// LED control page: on/off 0x00-0x17, then read-only open (0x18-0x2F) and short (0x30-0x47)
+constexpr uint8_t LED_CTRL_READ_SIZE = 0x48;
+
+}  // namespace
+
+void IS31FL3737Model::reset() {
+  for (auto &page : this->pages_) {
+    page.fill(0);
+  }
+  this->page_ = 0;
+  this->pointer_ = 0;
+  this->unlocked_ = false;
+  this->breath_started_ = false;
+}
+
+bool IS31FL3737Model::on_write(const uint8_t *data, size_t len) {
+  if (len == 0) {
+    return true;
+  }
+
+  uint8_t reg = data[0];
+  if (reg == REG_UNLOCK) {
+    if (len > 1) {
+      this->unlocked_ = data[1] == UNLOCK_VALUE;
+    }
+    return true;
+  }
+
+  if (reg == REG_COMMAND) {
+    if (len > 1) {
+      // The lock re-engages after one command register write, accepted or not
+      if (!this->unlocked_) {
+        this->locked_command_writes_++;
+      } else if (data[1] < IS31FL3737_MODEL_PAGES) {
+        if (data[1] != this->page_) {
+          this->page_changes_++;
+        }
+        this->page_ = data[1];
+      }
+      this->unlocked_ = false;
+    }
+    return true;
+  }
+
+  // Register pointer write, optionally followed by an auto-incrementing burst
+  this->pointer_ = reg;
+  for (size_t i = 1; i < len; i++) {
+    if (this->writable_(this->pointer_)) {
+      this->pages_[this->page_][this->pointer_] = data[i];
+      if (this->page_ == 3 && this->pointer_ == REG_TIME_UPDATE && data[i] == 0x00) {
+        this->breath_started_ = true;
+        this->time_update_ms_ = esphome::millis();
+        this->time_updates_++;
+      }
+    } else {
+      this->dropped_writes_++;
+    }
+    this->pointer_++;
+  }
+  return true;
+}
+
+bool IS31FL3737Model::on_read(uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (this->page_ == 3 && this->pointer_ == REG_RESET) {
+      // Reading the reset register restores every register to its default
+      uint8_t page = this->page_;
+      this->reset();
+      this->page_ = page;
+      this->resets_++;
+      data[i] = 0;
+    } else {
+      data[i] = this->pointer_ < this->page_size_() ? this->pages_[this->page_][this->pointer_] : 0;
+    }
+    this->pointer_++;
+  }
+  return true;
+}
+
+bool IS31FL3737Model::led_enabled(uint8_t pwm_reg) const {
+  uint8_t row = pwm_reg / 16;
+  uint8_t column = pwm_reg % 16;
+  return (this->pages_[0][row * 2 + column / 8] >> (column % 8)) & 0x01;
+}
+
+uint8_t IS31FL3737Model::output(uint8_t pwm_reg) const {
+  if (this->is_shutdown() || !this->led_enabled(pwm_reg)) {
+    return 0;
+  }
+  uint8_t mode = this->abm(pwm_reg) & 0x03;
+  if (mode == 0 || !this->is_breath_enabled()) {
+    return this->pwm(pwm_reg);
+  }
+  if (!this->breath_started_) {
+    return 0;  // Breathing has not been started
+  }
+  return this->breath_level(mode, this->pwm(pwm_reg), esphome::millis() - this->time_update_ms_);
+}
+
+uint8_t IS31FL3737Model::breath_level(uint8_t abm, uint8_t peak, uint32_t elapsed_ms) const {
+  const uint8_t *cr = &this->pages_[3][REG_ABM1 + (abm - 1) * 4];
+  // Segment durations T1 rise, T2 hold, T3 fall, T4 off
+  uint32_t t[4] = {ramp_ms(cr[0] >> 5), hold_ms((cr[0] >> 1) & 0x0F), ramp_ms(cr[1] >> 5),
+                   hold_ms((cr[1] >> 1) & 0x0F)};
+  bool end_on = cr[2] & 0x10;
+  uint8_t loop_begin = (cr[2] >> 2) & 0x03;
+  uint16_t loops = ((cr[2] & 0x03) << 8) | cr[3];
+
+  // Walk the segments: the first cycle from T1, later cycles from loop_begin
+  uint32_t remaining = elapsed_ms;
+  uint8_t segment = 0;
+  uint32_t cycle = 0;
+  while (true) {
+    bool last_cycle = loops != 0 && cycle + 1 >= loops;
+    if (last_cycle && segment == (end_on ? 1 : 3)) {
+      return end_on ? peak : 0;  // Stopped at the loop end state
+    }
+    if (remaining < t[segment]) {
+      uint32_t position = remaining * peak / t[segment];
+      switch (segment) {
+        case 0:
+          return position;
+        case 1:
+          return peak;
+        case 2:
+          return peak - position;
+        default:
+          return 0;
+      }
+    }
+    remaining -= t[segment];
+    if (++segment == 4) {
+      segment = loop_begin;
+      cycle++;
+      if (t[0] + t[1] + t[2] + t[3] == 0) {
+        return end_on ? peak : 0;
+      }
+    }
+  }
+}
+
+bool IS31FL3737Model::writable_(uint8_t reg) const {
+  switch (this->page_) {
+    case 0:
+      return reg < IS31FL3737_MODEL_LED_CTRL_SIZE;
+    case 3:
+      return reg < IS31FL3737_MODEL_FUNCTION_SIZE;
+    default:
+      return reg < IS31FL3737_MODEL_PAGE_SIZE;
+  }
+}
+
+uint16_t IS31FL3737Model::page_size_() const {
+  switch (this->page_) {
+    case 0:
+      return LED_CTRL_READ_SIZE;
+    case 3:
+      return IS31FL3737_MODEL_FUNCTION_SIZE;
+    default:
+      return IS31FL3737_MODEL_PAGE_SIZE;
+  }
+}
+
+}  // namespace i2c_sim
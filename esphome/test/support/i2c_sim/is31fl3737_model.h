@@ -0,0 +1,88 @@
+/**
+ * Register model of the IS31FL3737 12×12 LED matrix driver
+ *
+ * Follows the datasheet register map:
+ * - 0xFE command register write lock: writing 0xC5 allows exactly one
+ *   write to the command register 0xFD, then the lock re-engages
+ * - 0xFD selects page 0-3; other values are ignored
+ * - Page 0 LED control (0x00-0x17 on/off, 0x18-0x2F open, 0x30-0x47 short)
+ * - Page 1 PWM (0x00-0xBF), page 2 ABM mode select (0x00-0xBF)
+ * - Page 3 function registers (0x00-0x10); reading 0x11 resets the chip
+ * - Register pointer auto-increments on burst reads and writes
+ * - Auto breath: LEDs set to ABM-1/2/3 on page 2 follow that waveform
+ *   (linear rise/hold/fall/off, loops, loop begin/end) once B_EN is set,
+ *   timed from the last write to the time update register (0x0E)
+ *
+ * Writes to read-only or unimplemented registers are dropped and counted so
+ * tests can catch drivers that scribble past the register map.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "simulated_bus.h"
+
+namespace i2c_sim {
+
+constexpr uint8_t IS31FL3737_MODEL_PAGES = 4;
+constexpr uint16_t IS31FL3737_MODEL_PAGE_SIZE = 0xC0;
+constexpr uint8_t IS31FL3737_MODEL_LED_CTRL_SIZE = 0x18;
+constexpr uint8_t IS31FL3737_MODEL_FUNCTION_SIZE = 0x11;
+
+class IS31FL3737Model : public DeviceModel {
+ public:
+  IS31FL3737Model() { this->reset(); }
+
+  bool on_write(const uint8_t *data, size_t len) override;
+  bool on_read(uint8_t *data, size_t len) override;
+
+  // Power-on state: all registers zero, software shutdown, page 0
+  void reset();
+
+  uint8_t page() const { return this->page_; }
+  bool is_unlocked() const { return this->unlocked_; }
+  bool is_shutdown() const { return !(this->function(0x00) & 0x01); }
+  uint8_t global_current() const { return this->function(0x01); }
+  bool is_breath_enabled() const { return this->function(0x00) & 0x02; }
+
+  uint8_t led_control(uint8_t reg) const { return this->pages_[0][reg]; }
+  uint8_t pwm(uint8_t reg) const { return this->pages_[1][reg]; }
+  const uint8_t *pwm_page() const { return this->pages_[1].data(); }
+  uint8_t abm(uint8_t reg) const { return this->pages_[2][reg]; }
+  uint8_t function(uint8_t reg) const { return this->pages_[3][reg]; }
+
+  // LED on/off bit for the LED at a PWM register address (SWy row, CSx column)
+  bool led_enabled(uint8_t pwm_reg) const;
+  // What the LED at a PWM register address shows right now (host millis()):
+  // 0 in shutdown or when disabled, the ABM waveform level for breathing
+  // LEDs, otherwise the PWM duty
+  uint8_t output(uint8_t pwm_reg) const;
+  // Level of an ABM-n waveform with the given peak, elapsed_ms after the time update
+  uint8_t breath_level(uint8_t abm, uint8_t peak, uint32_t elapsed_ms) const;
+
+  uint32_t resets() const { return this->resets_; }
+  uint32_t page_changes() const { return this->page_changes_; }
+  uint32_t time_updates() const { return this->time_updates_; }
+  uint32_t locked_command_writes() const { return this->locked_command_writes_; }  // 0xFD without unlock
+  uint32_t dropped_writes() const { return this->dropped_writes_; }  // Bytes to read-only/invalid registers
+
+ protected:
+  bool writable_(uint8_t reg) const;
+  uint16_t page_size_() const;
+
+  std::array<std::array<uint8_t, IS31FL3737_MODEL_PAGE_SIZE>, IS31FL3737_MODEL_PAGES> pages_{};
+  uint8_t page_{0};
+  uint8_t pointer_{0};
+  bool unlocked_{false};
+
+  bool breath_started_{false};  // Time update written since the last reset
+  uint32_t time_update_ms_{0};
+
+  uint32_t resets_{0};
+  uint32_t time_updates_{0};
+  uint32_t page_changes_{0};
+  uint32_t locked_command_writes_{0};
+  uint32_t dropped_writes_{0};
+};
+
+}  // namespace i2c_sim
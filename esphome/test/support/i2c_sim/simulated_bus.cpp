@@ -0,0 +1,79 @@
+/**
+ * Simulated I2C bus for native tests
+ */
+#include "simulated_bus.h"
+#include "esphome/core/hal.h"
+
+namespace i2c_sim {
+
+using esphome::i2c::ErrorCode;
+
+void SimulatedBus::set_nack(uint8_t address, bool nack) { this->nack_[address] = nack; }
+
+ErrorCode SimulatedBus::write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count,
+                                    uint8_t *read_buffer, size_t read_count) {
+  auto it = this->devices_.find(address);
+  bool present = it != this->devices_.end() && !this->nack_[address];
+  bool ok = present;
+  if (ok && write_count > 0) {
+    ok = it->second->on_write(write_buffer, write_count);
+  }
+  if (ok && read_count > 0) {
+    ok = it->second->on_read(read_buffer, read_count);
+  }
+
+  this->account_(address, write_count, read_count, present, !ok);
+  return ok ? esphome::i2c::ERROR_OK : esphome::i2c::ERROR_NOT_ACKNOWLEDGED;
+}
+
+BusStats SimulatedBus::device_stats(uint8_t address) const {
+  auto it = this->device_stats_.find(address);
+  return it == this->device_stats_.end() ? BusStats{} : it->second;
+}
+
+void SimulatedBus::reset_stats() {
+  this->stats_ = BusStats{};
+  this->device_stats_.clear();
+}
+
+void SimulatedBus::account_(uint8_t address, size_t write_len, size_t read_len, bool present, bool nack) {
+  // Address byte plus data for each phase; a read without a write still has one phase
+  bool write = write_len > 0;
+  bool read = read_len > 0 || !write;
+  // A missing device NACKs its address byte, so no data bytes are clocked
+  if (!present) {
+    write_len = 0;
+    read_len = 0;
+  }
+  uint64_t bits = I2C_FRAMING_BITS;
+  if (write) {
+    bits += (1 + write_len) * I2C_BITS_PER_BYTE;
+  }
+  if (read) {
+    bits += (write ? 1 : 0) + (1 + read_len) * I2C_BITS_PER_BYTE;
+  }
+
+  for (BusStats *stats : {&this->stats_, &this->device_stats_[address]}) {
+    stats->transactions++;
+    if (write) {
+      stats->writes++;
+    }
+    if (read) {
+      stats->reads++;
+    }
+    if (nack) {
+      stats->nacks++;
+    }
+    stats->bytes += write_len + read_len;
+    stats->bits += bits;
+  }
+
+  if (this->clock_frequency_hz_ > 0) {
+    // Carry the fractional microseconds so long runs don't drift
+    uint64_t scaled = bits * 1000000ULL + this->clock_remainder_;
+    host_time::advance_us(static_cast<uint32_t>(scaled / this->clock_frequency_hz_));
+    this->clock_remainder_ = scaled % this->clock_frequency_hz_;
+  }
+}
+
+}  // namespace i2c_sim
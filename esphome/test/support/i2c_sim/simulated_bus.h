@@ -0,0 +1,89 @@
+/**
+ * Simulated I2C bus for native tests
+ *
+ * Implements esphome::i2c::I2CBus and routes each transaction to a device
+ * model attached at the target address. Addresses without a model NACK.
+ *
+ * Every transaction is counted, along with the number of bits it would take
+ * on the wire (start, address byte, data bytes with ACK, stop), so tests can
+ * report bus time per frame at any SCL frequency. Optionally the host clock
+ * is advanced by the wire time of each transaction, which makes the
+ * component's own micros() timing behave as if the bus were real.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "esphome/components/i2c/i2c.h"
+
+namespace i2c_sim {
+
+constexpr uint32_t I2C_STANDARD_MODE_HZ = 100000;
+constexpr uint32_t I2C_FAST_MODE_HZ = 400000;
+constexpr uint32_t I2C_FAST_MODE_PLUS_HZ = 1000000;
+
+// Bits on the wire for one byte: 8 data bits + ACK
+constexpr uint32_t I2C_BITS_PER_BYTE = 9;
+// START and STOP, counted as one bit time each (a repeated START between
+// the write and read phases adds one more)
+constexpr uint32_t I2C_FRAMING_BITS = 2;
+
+/**
+ * A device on the simulated bus
+ *
+ * Writes carry the register pointer as their first byte, as on the real
+ * chips. A write of the pointer alone followed by a read is a register read.
+ * Return false to NACK the transaction.
+ */
+class DeviceModel {
+ public:
+  virtual ~DeviceModel() = default;
+  virtual bool on_write(const uint8_t *data, size_t len) = 0;
+  virtual bool on_read(uint8_t *data, size_t len) = 0;
+};
+
+struct BusStats {
+  uint32_t transactions{0};  // write_readv calls, including NACKed ones
+  uint32_t writes{0};        // Transactions with a write phase
+  uint32_t reads{0};         // Transactions with a read phase (a register read counts as both)
+  uint32_t nacks{0};
+  uint64_t bytes{0};  // Payload bytes (excluding the address byte)
+  uint64_t bits{0};   // Wire bits including framing, address and ACKs
+
+  // Time the traffic so far would occupy the bus at the given SCL frequency
+  double time_us(uint32_t frequency_hz) const { return (double) this->bits * 1e6 / frequency_hz; }
+};
+
+class SimulatedBus : public esphome::i2c::I2CBus {
+ public:
+  void attach(uint8_t address, DeviceModel *device) { this->devices_[address] = device; }
+  void detach(uint8_t address) { this->devices_.erase(address); }
+
+  // Make an attached device NACK every transaction (e.g. a board unplugged)
+  void set_nack(uint8_t address, bool nack);
+
+  // Advance host_time by the wire time of each transaction at this frequency
+  // (0 = bus is instantaneous, the default)
+  void set_clock_frequency(uint32_t frequency_hz) { this->clock_frequency_hz_ = frequency_hz; }
+
+  esphome::i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count,
+                                      uint8_t *read_buffer, size_t read_count) override;
+
+  const BusStats &stats() const { return this->stats_; }
+  // Traffic to one address (empty stats if nothing was sent there)
+  BusStats device_stats(uint8_t address) const;
+  void reset_stats();
+
+ protected:
+  void account_(uint8_t address, size_t write_len, size_t read_len, bool present, bool nack);
+
+  std::map<uint8_t, DeviceModel *> devices_;
+  std::map<uint8_t, bool> nack_;
+  std::map<uint8_t, BusStats> device_stats_;
+  BusStats stats_;
+  uint32_t clock_frequency_hz_{0};
+  uint64_t clock_remainder_{0};  // Sub-microsecond wire time carried between transactions
+};
+
+}  // namespace i2c_sim
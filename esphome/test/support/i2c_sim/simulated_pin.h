@@ -0,0 +1,88 @@
+/**
+ * GPIO input pin driven by a test or a chip model
+ *
+ * set_level() changes the line and calls the attached interrupt handler
+ * when the change matches its edge type, the way the GPIO peripheral would.
+ * Level-triggered interrupts fire on every set_level() call at that level.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "esphome/core/gpio.h"
+
+namespace i2c_sim {
+
+class SimulatedPin : public esphome::InternalGPIOPin {
+ public:
+  explicit SimulatedPin(uint8_t pin = 0, bool level = true) : pin_(pin), level_(level) {}
+
+  void setup() override { this->setup_calls_++; }
+  void pin_mode(esphome::gpio::Flags flags) override { this->flags_ = flags; }
+  bool digital_read() override {
+    this->reads_++;
+    return this->level_;
+  }
+  void digital_write(bool value) override { this->set_level(value); }
+  std::string dump_summary() const override { return "GPIO" + std::to_string(this->pin_); }
+  void detach_interrupt() const override { this->isr_ = nullptr; }
+  uint8_t get_pin() const override { return this->pin_; }
+  bool is_inverted() const override { return false; }
+
+  void set_level(bool level) {
+    bool was = this->level_;
+    this->level_ = level;
+    if (this->isr_ == nullptr) {
+      return;
+    }
+    bool fire = false;
+    switch (this->type_) {
+      case esphome::gpio::INTERRUPT_RISING_EDGE:
+        fire = !was && level;
+        break;
+      case esphome::gpio::INTERRUPT_FALLING_EDGE:
+        fire = was && !level;
+        break;
+      case esphome::gpio::INTERRUPT_ANY_EDGE:
+        fire = was != level;
+        break;
+      case esphome::gpio::INTERRUPT_LOW_LEVEL:
+        fire = !level;
+        break;
+      case esphome::gpio::INTERRUPT_HIGH_LEVEL:
+        fire = level;
+        break;
+    }
+    if (fire) {
+      this->interrupts_++;
+      this->isr_(this->isr_arg_);
+    }
+  }
+
+  bool level() const { return this->level_; }
+  bool has_interrupt() const { return this->isr_ != nullptr; }
+  esphome::gpio::InterruptType interrupt_type() const { return this->type_; }
+  esphome::gpio::Flags flags() const { return this->flags_; }
+  uint32_t setup_calls() const { return this->setup_calls_; }
+  uint32_t interrupts() const { return this->interrupts_; }
+  uint32_t reads() const { return this->reads_; }
+
+ protected:
+  void attach_interrupt(void (*func)(void *), void *arg, esphome::gpio::InterruptType type) const override {
+    this->isr_ = func;
+    this->isr_arg_ = arg;
+    this->type_ = type;
+  }
+
+  uint8_t pin_;
+  bool level_;
+  esphome::gpio::Flags flags_{esphome::gpio::FLAG_NONE};
+  mutable void (*isr_)(void *){nullptr};
+  mutable void *isr_arg_{nullptr};
+  mutable esphome::gpio::InterruptType type_{esphome::gpio::INTERRUPT_ANY_EDGE};
+  uint32_t setup_calls_{0};
+  uint32_t interrupts_{0};
+  uint32_t reads_{0};
+};
+
+}  // namespace i2c_sim
@@ -0,0 +1,134 @@
+/**
+ * Register model of the TCA8418
+ */
+#include "tca8418_model.h"
+#include <cstring>
+
+namespace i2c_sim {
+
+namespace {
+
+constexpr uint8_t REG_CFG = 0x01;
+constexpr uint8_t REG_INT_STAT = 0x02;
+constexpr uint8_t REG_KEY_LCK_EC = 0x03;
+constexpr uint8_t REG_KEY_EVENT_A = 0x04;
+constexpr uint8_t REG_KEY_EVENT_J = 0x0D;
+
+constexpr uint8_t CFG_AI = 0x80;
+constexpr uint8_t CFG_OVR_FLOW_M = 0x20;
+constexpr uint8_t CFG_OVR_FLOW_IEN = 0x08;
+constexpr uint8_t CFG_KE_IEN = 0x01;
+
+constexpr uint8_t INT_STAT_OVR_FLOW = 0x08;
+constexpr uint8_t INT_STAT_K_INT = 0x01;
+
+}  // namespace
+
+void TCA8418Model::reset() {
+  memset(this->registers_, 0, sizeof(this->registers_));
+  this->fifo_.clear();
+  this->pointer_ = 0;
+  this->notify_int_();
+}
+
+void TCA8418Model::press(uint8_t row, uint8_t col) { this->push_event(0x80 | (row * 10 + col + 1)); }
+
+void TCA8418Model::release(uint8_t row, uint8_t col) { this->push_event(row * 10 + col + 1); }
+
+void TCA8418Model::push_event(uint8_t event) {
+  if (this->fifo_.size() >= TCA8418_MODEL_FIFO_SIZE) {
+    this->registers_[REG_INT_STAT] |= INT_STAT_OVR_FLOW;
+    this->events_lost_++;
+    if (!(this->registers_[REG_CFG] & CFG_OVR_FLOW_M)) {
+      this->notify_int_();
+      return;
+    }
+    this->fifo_.pop_front();
+  }
+  this->fifo_.push_back(event);
+  this->update_key_interrupt_();
+}
+
+bool TCA8418Model::int_asserted() const {
+  uint8_t cfg = this->registers_[REG_CFG];
+  uint8_t stat = this->registers_[REG_INT_STAT];
+  return ((cfg & CFG_KE_IEN) && (stat & INT_STAT_K_INT)) || ((cfg & CFG_OVR_FLOW_IEN) && (stat & INT_STAT_OVR_FLOW));
+}
+
+bool TCA8418Model::on_write(const uint8_t *data, size_t len) {
+  if (len == 0) {
+    return true;
+  }
+
+  this->pointer_ = data[0];
+  for (size_t i = 1; i < len; i++) {
+    uint8_t reg = this->pointer_;
+    if (reg == REG_INT_STAT) {
+      this->registers_[reg] &= ~data[i];
+      this->update_key_interrupt_();
+    } else if (reg == REG_KEY_LCK_EC) {
+      // Only the lock enable bit is writable; the event count is read-only
+      this->registers_[reg] = (this->registers_[reg] & 0x3F) | (data[i] & 0x40);
+    } else if (reg >= REG_KEY_EVENT_A && reg <= REG_KEY_EVENT_J) {
+      // FIFO registers are read-only
+    } else if (reg < TCA8418_MODEL_REGISTERS) {
+      this->registers_[reg] = data[i];
+    }
+    if (this->registers_[REG_CFG] & CFG_AI) {
+      this->pointer_++;
+    }
+  }
+  this->notify_int_();
+  return true;
+}
+
+bool TCA8418Model::on_read(uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    data[i] = this->read_register_(this->pointer_);
+    if (this->registers_[REG_CFG] & CFG_AI) {
+      this->pointer_++;
+    }
+  }
+  return true;
+}
+
+uint8_t TCA8418Model::read_register_(uint8_t reg) {
+  if (reg == REG_KEY_LCK_EC) {
+    return (this->registers_[reg] & 0xF0) | static_cast<uint8_t>(this->fifo_.size());
+  }
+  if (reg == REG_KEY_EVENT_A) {
+    if (this->fifo_.empty()) {
+      return 0;
+    }
+    uint8_t event = this->fifo_.front();
+    this->fifo_.pop_front();
+    this->events_read_++;
+    return event;
+  }
+  if (reg > REG_KEY_EVENT_A && reg <= REG_KEY_EVENT_J) {
+    // Deeper FIFO slots can be inspected without popping
+    size_t slot = reg - REG_KEY_EVENT_A;
+    return slot < this->fifo_.size() ? this->fifo_[slot] : 0;
+  }
+  return reg < TCA8418_MODEL_REGISTERS ? this->registers_[reg] : 0;
+}
+
+void TCA8418Model::update_key_interrupt_() {
+  if (!this->fifo_.empty()) {
+    this->registers_[REG_INT_STAT] |= INT_STAT_K_INT;
+  }
+  this->notify_int_();
+}
+
+void TCA8418Model::notify_int_() {
+  bool asserted = this->int_asserted();
+  if (asserted == this->int_line_) {
+    return;
+  }
+  this->int_line_ = asserted;
+  if (this->int_listener_) {
+    this->int_listener_(asserted);
+  }
+}
+
+}  // namespace i2c_sim
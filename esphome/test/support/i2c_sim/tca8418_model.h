@@ -0,0 +1,74 @@
+/**
+ * Register model of the TCA8418 keypad scan controller
+ *
+ * Models the parts of the datasheet the keypad component relies on:
+ * - 10-entry key event FIFO; KEY_LCK_EC (0x03) bits 3-0 hold the count
+ * - Reading KEY_EVENT_A (0x04) pops the oldest event, 0 when empty
+ * - Register pointer auto-increments only when CFG.AI is set, so a burst
+ *   read of KEY_EVENT_A with AI clear pops one event per byte
+ * - INT_STAT (0x02) bits are write-1-to-clear; K_INT re-asserts while the
+ *   FIFO still holds events
+ * - FIFO overflow sets OVR_FLOW_INT; with CFG.OVR_FLOW_M the oldest event
+ *   is pushed out, otherwise the new event is lost
+ * - /INT (active low) follows INT_STAT gated by the CFG enables; an
+ *   optional listener is told about every change of the line
+ *
+ * Key matrix scanning and debounce are not modelled: tests inject events
+ * with press()/release() as the chip would report them.
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include "simulated_bus.h"
+
+namespace i2c_sim {
+
+constexpr uint8_t TCA8418_MODEL_FIFO_SIZE = 10;
+constexpr uint8_t TCA8418_MODEL_REGISTERS = 0x2F;
+
+class TCA8418Model : public DeviceModel {
+ public:
+  TCA8418Model() { this->reset(); }
+
+  bool on_write(const uint8_t *data, size_t len) override;
+  bool on_read(uint8_t *data, size_t len) override;
+
+  void reset();
+
+  // Queue a matrix key event (row 0-7, col 0-9) as the scanner would
+  void press(uint8_t row, uint8_t col);
+  void release(uint8_t row, uint8_t col);
+  void push_event(uint8_t event);
+
+  uint8_t fifo_count() const { return static_cast<uint8_t>(this->fifo_.size()); }
+  uint8_t reg(uint8_t reg) const { return this->registers_[reg]; }
+  uint8_t int_stat() const { return this->registers_[0x02]; }
+  // /INT pin asserted (driven low)
+  bool int_asserted() const;
+  // Called with the new /INT state whenever it changes (wire it to a SimulatedPin)
+  void on_int_change(std::function<void(bool asserted)> listener) {
+    this->int_listener_ = std::move(listener);
+    this->int_line_ = this->int_asserted();
+  }
+
+  uint32_t events_lost() const { return this->events_lost_; }  // Dropped or pushed out by overflow
+  uint32_t events_read() const { return this->events_read_; }
+
+ protected:
+  uint8_t read_register_(uint8_t reg);
+  void update_key_interrupt_();
+  void notify_int_();
+
+  uint8_t registers_[TCA8418_MODEL_REGISTERS]{};
+  std::deque<uint8_t> fifo_;
+  uint8_t pointer_{0};
+  std::function<void(bool)> int_listener_;
+  bool int_line_{false};
+
+  uint32_t events_lost_{0};
+  uint32_t events_read_{0};
+};
+
+}  // namespace i2c_sim
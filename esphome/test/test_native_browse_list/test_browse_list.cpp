@@ -0,0 +1,181 @@
+/**
+ * @file test_browse_list.cpp
+ * @brief Unit tests for the unified browse list segments and stable IDs
+ */
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "esphome/components/radio_controller/browse_list.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+StringArena *strings;
+std::vector<BrowseItem> *items;
+size_t selected;
+int playing;
+
+// Preset slots only, the way build_browse_list_() starts
+void add_presets() {
+  for (uint8_t slot = 0; slot < BROWSE_PRESET_SLOTS; slot++) {
+    BrowseItem item;
+    item.id = 1 + slot;
+    item.preset_index = slot;
+    item.name = strings->add("Preset " + std::to_string(slot + 1));
+    items->push_back(item);
+  }
+}
+
+// Source entries "<name>" -> "library://<name>", or the given URI
+std::vector<PlaylistItem> source(const std::vector<const char *> &names, const char *uri = nullptr) {
+  std::vector<PlaylistItem> list;
+  for (const char *name : names) {
+    list.push_back({strings->add(name), strings->add(uri != nullptr ? uri : std::string("library://") + name)});
+  }
+  return list;
+}
+
+void replace(BrowseItem::Type type, const std::vector<PlaylistItem> &list) {
+  replace_browse_segment(*items, type, list, *strings, selected, playing);
+}
+
+const char *name_at(size_t index) { return strings->c_str((*items)[index].name); }
+
+}  // namespace
+
+void setUp(void) {
+  strings = new StringArena();
+  items = new std::vector<BrowseItem>();
+  selected = 0;
+  playing = -1;
+  add_presets();
+}
+
+void tearDown(void) {
+  delete items;
+  delete strings;
+}
+
+void test_separator_follows_the_segments() {
+  replace(BrowseItem::FAVORITE, {});
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS, items->size());
+
+  replace(BrowseItem::FAVORITE, source({"FIP"}));
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS + 2, items->size());
+  TEST_ASSERT_EQUAL_UINT32(BROWSE_ID_SEPARATOR, (*items)[BROWSE_PRESET_SLOTS].id);
+  TEST_ASSERT_EQUAL_STRING(BROWSE_SEPARATOR_NAME, name_at(BROWSE_PRESET_SLOTS));
+
+  // Still wanted while the other segment has items
+  replace(BrowseItem::PLAYLIST, source({"Chill Beats"}));
+  replace(BrowseItem::FAVORITE, {});
+  TEST_ASSERT_EQUAL_UINT32(BROWSE_ID_SEPARATOR, (*items)[BROWSE_PRESET_SLOTS].id);
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS + 2, items->size());
+
+  size_t garbage = strings->get_garbage();
+  replace(BrowseItem::PLAYLIST, {});
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS, items->size());
+  // The separator's own string is released with it
+  TEST_ASSERT_EQUAL_size_t(garbage + strlen(BROWSE_SEPARATOR_NAME) + 1, strings->get_garbage());
+}
+
+void test_segments_resize_in_type_order() {
+  replace(BrowseItem::FAVORITE, source({"FIP", "KEXP", "Zwei"}));
+  replace(BrowseItem::PLAYLIST, source({"Ambient Mix", "Chill Beats"}));
+  auto playlists = browse_segment(*items, BrowseItem::PLAYLIST);
+  auto favorites = browse_segment(*items, BrowseItem::FAVORITE);
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS + 1, playlists.first);
+  TEST_ASSERT_EQUAL_size_t(playlists.first + 2, favorites.first);
+  TEST_ASSERT_EQUAL_size_t(items->size(), favorites.second);
+
+  // Growing the playlists shifts the favorites along; shrinking them back pulls them in
+  replace(BrowseItem::PLAYLIST, source({"Ambient Mix", "Chill Beats", "Focus", "Sleep"}));
+  favorites = browse_segment(*items, BrowseItem::FAVORITE);
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS + 5, favorites.first);
+  TEST_ASSERT_EQUAL_STRING("FIP", name_at(favorites.first));
+  replace(BrowseItem::FAVORITE, source({"KEXP"}));
+  replace(BrowseItem::PLAYLIST, source({"Sleep"}));
+  TEST_ASSERT_EQUAL_size_t(BROWSE_PRESET_SLOTS + 3, items->size());
+  TEST_ASSERT_EQUAL_STRING("Sleep", name_at(BROWSE_PRESET_SLOTS + 1));
+  TEST_ASSERT_EQUAL_STRING("KEXP", name_at(BROWSE_PRESET_SLOTS + 2));
+}
+
+void test_selection_and_playing_follow_their_ids() {
+  replace(BrowseItem::FAVORITE, source({"FIP", "KEXP", "Zwei"}));
+  selected = BROWSE_PRESET_SLOTS + 2;  // KEXP
+  playing = BROWSE_PRESET_SLOTS + 3;   // Zwei
+
+  // A reload that moves both
+  replace(BrowseItem::PLAYLIST, source({"Ambient Mix"}));
+  replace(BrowseItem::FAVORITE, source({"Bayern 3", "FIP", "KEXP", "Zwei"}));
+  TEST_ASSERT_EQUAL_STRING("KEXP", name_at(selected));
+  TEST_ASSERT_EQUAL_STRING("Zwei", name_at(playing));
+
+  // Gone: the selection stays in range, the playing item is unlisted
+  replace(BrowseItem::FAVORITE, source({"Bayern 3"}));
+  TEST_ASSERT_EQUAL_size_t(items->size() - 1, selected);
+  TEST_ASSERT_EQUAL_INT(-1, playing);
+}
+
+void test_duplicate_uris_get_distinct_stable_ids() {
+  auto list = source({"FIP", "FIP (copy)"}, "library://radio/7");
+  replace(BrowseItem::FAVORITE, list);
+  uint32_t first = (*items)[BROWSE_PRESET_SLOTS + 1].id;
+  uint32_t second = (*items)[BROWSE_PRESET_SLOTS + 2].id;
+  TEST_ASSERT_EQUAL_UINT32(browse_uri_id(BrowseItem::FAVORITE, "library://radio/7"), first);
+  TEST_ASSERT_NOT_EQUAL(first, second);
+  TEST_ASSERT_EQUAL_UINT32(BrowseItem::FAVORITE, second >> 30);
+
+  // The later one is found by position, and again after a reload
+  selected = BROWSE_PRESET_SLOTS + 2;
+  TEST_ASSERT_EQUAL_INT(BROWSE_PRESET_SLOTS + 2, find_browse_item(*items, second, 0));
+  replace(BrowseItem::PLAYLIST, source({"Ambient Mix"}));
+  TEST_ASSERT_EQUAL_STRING("FIP (copy)", name_at(selected));
+  TEST_ASSERT_EQUAL_UINT32(second, (*items)[selected].id);
+}
+
+void test_compaction_reshares_segment_strings() {
+  // The list before a reload, released ahead of the new one so its strings move
+  auto old = source({"Old 1", "Old 2", "Old 3"});
+  auto favorites = source({"FIP", "KEXP"});
+  for (auto &dropped : old) {
+    strings->release(dropped.name);
+    strings->release(dropped.uri);
+  }
+  replace(BrowseItem::FAVORITE, favorites);
+  size_t moved_from = favorites[0].name.offset;
+
+  strings->compact([&](auto &&visit) {
+    for (auto &item : *items) {
+      if (item.type == BrowseItem::PRESET) {
+        visit(item.name);
+        visit(item.target);
+      }
+    }
+    for (auto &item : favorites) {
+      visit(item.name);
+      visit(item.uri);
+    }
+  });
+  reshare_browse_segment(*items, BrowseItem::FAVORITE, favorites);
+
+  TEST_ASSERT_EQUAL_UINT32(0, strings->get_garbage());
+  TEST_ASSERT_NOT_EQUAL(moved_from, favorites[0].name.offset);
+  TEST_ASSERT_EQUAL_STRING("Preset 1", name_at(0));
+  TEST_ASSERT_EQUAL_STRING(BROWSE_SEPARATOR_NAME, name_at(BROWSE_PRESET_SLOTS));
+  TEST_ASSERT_EQUAL_STRING("FIP", name_at(BROWSE_PRESET_SLOTS + 1));
+  TEST_ASSERT_EQUAL_STRING("library://KEXP", strings->c_str((*items)[BROWSE_PRESET_SLOTS + 2].target));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_separator_follows_the_segments);
+  RUN_TEST(test_segments_resize_in_type_order);
+  RUN_TEST(test_selection_and_playing_follow_their_ids);
+  RUN_TEST(test_duplicate_uris_get_distinct_stable_ids);
+  RUN_TEST(test_compaction_reshares_segment_strings);
+
+  return UNITY_END();
+}
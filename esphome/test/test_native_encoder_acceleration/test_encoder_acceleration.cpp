@@ -0,0 +1,125 @@
+/**
+ * @file test_encoder_acceleration.cpp
+ * @brief Unit tests for the encoder velocity curve
+ */
+
+#include <unity.h>
+#include "esphome/components/radio_controller/encoder_acceleration.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+EncoderAcceleration *accel;
+
+// Detents `interval_ms` apart after `now_us`; returns the last step
+uint16_t spin(uint32_t &now_us, int count, uint32_t interval_ms, int8_t direction = 1) {
+  uint16_t step = 0;
+  for (int i = 0; i < count; i++) {
+    now_us += interval_ms * 1000;
+    step = accel->on_detent(now_us, direction);
+  }
+  return step;
+}
+
+}  // namespace
+
+void setUp(void) {
+  accel = new EncoderAcceleration();
+  // Same curve as the radio config, added out of order
+  accel->add_point(60, 5);
+  accel->add_point(120, 2);
+  accel->add_point(30, ENCODER_STEP_GROUP);
+}
+
+void tearDown(void) { delete accel; }
+
+void test_points_sorted_slowest_first() {
+  const auto &points = accel->get_points();
+  TEST_ASSERT_EQUAL_size_t(3, points.size());
+  TEST_ASSERT_EQUAL_UINT32(120000, points[0].below_us);
+  TEST_ASSERT_EQUAL_UINT32(60000, points[1].below_us);
+  TEST_ASSERT_EQUAL_UINT32(30000, points[2].below_us);
+}
+
+void test_slow_clicks_move_one_item() {
+  uint32_t now = 0;
+  TEST_ASSERT_EQUAL_UINT16(1, spin(now, 10, 200));
+  TEST_ASSERT_FALSE(accel->is_spinning());
+}
+
+void test_step_follows_detent_rate() {
+  uint32_t now = 0;
+  // First detent of a spin has nothing to compare with
+  TEST_ASSERT_EQUAL_UINT16(1, spin(now, 1, 500));
+  TEST_ASSERT_EQUAL_UINT16(2, spin(now, 3, 90));
+  TEST_ASSERT_TRUE(accel->is_spinning());
+  TEST_ASSERT_EQUAL_UINT16(5, spin(now, 3, 45));
+  TEST_ASSERT_EQUAL_UINT16(ENCODER_STEP_GROUP, spin(now, 4, 15));
+}
+
+void test_single_fast_edge_is_averaged() {
+  uint32_t now = 0;
+  spin(now, 4, 100);
+  // One 20 ms interval among 100 ms ones averages to 60 ms: not yet a group jump
+  TEST_ASSERT_EQUAL_UINT16(2, spin(now, 1, 20));
+}
+
+void test_same_timestamp_detents_carry_no_rate() {
+  // Two detents from one drain, from rest: no interval yet, so no group jump
+  uint32_t now = 1000000;
+  TEST_ASSERT_EQUAL_UINT16(1, accel->on_detent(now, 1));
+  TEST_ASSERT_EQUAL_UINT16(1, accel->on_detent(now, 1));
+  TEST_ASSERT_FALSE(accel->is_spinning());
+
+  // Mid-spin, a same-stamp detent keeps the current rate
+  TEST_ASSERT_EQUAL_UINT16(2, spin(now, 1, 100));
+  TEST_ASSERT_TRUE(accel->is_spinning());
+  TEST_ASSERT_EQUAL_UINT16(2, accel->on_detent(now, 1));
+  TEST_ASSERT_EQUAL_UINT32(100000, accel->get_interval_us());
+}
+
+void test_pause_or_reversal_starts_over() {
+  uint32_t now = 0;
+  TEST_ASSERT_EQUAL_UINT16(5, spin(now, 5, 40));
+  // Pause longer than the slowest point
+  TEST_ASSERT_EQUAL_UINT16(1, spin(now, 1, 130));
+  TEST_ASSERT_FALSE(accel->is_spinning());
+
+  TEST_ASSERT_EQUAL_UINT16(5, spin(now, 5, 40));
+  // Direction change
+  TEST_ASSERT_EQUAL_UINT16(1, spin(now, 1, 40, -1));
+
+  TEST_ASSERT_EQUAL_UINT16(5, spin(now, 5, 40, -1));
+  accel->reset();
+  TEST_ASSERT_EQUAL_UINT16(1, spin(now, 1, 40, -1));
+}
+
+void test_timestamps_wrap() {
+  uint32_t now = UINT32_MAX - 50000;
+  spin(now, 1, 10);
+  TEST_ASSERT_EQUAL_UINT16(ENCODER_STEP_GROUP, spin(now, 3, 20));
+}
+
+void test_disabled_without_curve() {
+  EncoderAcceleration plain;
+  TEST_ASSERT_FALSE(plain.is_enabled());
+  TEST_ASSERT_EQUAL_UINT16(1, plain.on_detent(1000, 1));
+  TEST_ASSERT_EQUAL_UINT16(1, plain.on_detent(2000, 1));
+  TEST_ASSERT_FALSE(plain.is_spinning());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_points_sorted_slowest_first);
+  RUN_TEST(test_slow_clicks_move_one_item);
+  RUN_TEST(test_step_follows_detent_rate);
+  RUN_TEST(test_single_fast_edge_is_averaged);
+  RUN_TEST(test_same_timestamp_detents_carry_no_rate);
+  RUN_TEST(test_pause_or_reversal_starts_over);
+  RUN_TEST(test_timestamps_wrap);
+  RUN_TEST(test_disabled_without_curve);
+
+  return UNITY_END();
+}
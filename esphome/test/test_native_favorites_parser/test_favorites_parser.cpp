@@ -0,0 +1,236 @@
+/**
+ * @file test_favorites_parser.cpp
+ * @brief Tests and host benchmark for the streaming favorites parser
+ *
+ * The benchmark counts heap allocations through replaced global operator
+ * new/delete, so "peak" is the most heap held at once during a parse on top
+ * of what was live before it (the payload string itself is not counted).
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "esphome/components/radio_controller/favorites_parser.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+size_t heap_live = 0;
+size_t heap_peak = 0;
+
+struct Favorite {
+  std::string name;
+  std::string uri;
+};
+
+struct Collector {
+  std::vector<Favorite> items;
+  FavoritesParser parser{[this](const char *name, size_t name_length, const char *uri, size_t uri_length) {
+    this->items.push_back({std::string(name, name_length), std::string(uri, uri_length)});
+  }};
+
+  bool parse(const std::string &json) {
+    this->parser.reset();
+    return this->parser.feed(json.data(), json.size()) && this->parser.finish();
+  }
+};
+
+// Payload shaped like the Music Assistant favorites script output
+std::string make_payload(int count) {
+  std::string json = "[";
+  char item[256];
+  for (int i = 0; i < count; i++) {
+    snprintf(item, sizeof(item),
+             "%s{\"name\": \"Station %d \\u00e9t\\u00e9 Radio\", \"uri\": \"library://radio/%d\", "
+             "\"media_type\": \"radio\", \"favorite\": true, \"provider_mappings\": [{\"item_id\": \"%d\"}]}",
+             i == 0 ? "" : ", ", i, i, i * 7);
+    json += item;
+  }
+  json += "]";
+  return json;
+}
+
+}  // namespace
+
+// Heap accounting for the benchmark (sizes are stored in front of each block)
+void *operator new(size_t size) {
+  void *block = std::malloc(size + sizeof(size_t));
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  *static_cast<size_t *>(block) = size;
+  heap_live += size;
+  if (heap_live > heap_peak) {
+    heap_peak = heap_live;
+  }
+  return static_cast<size_t *>(block) + 1;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  size_t *block = static_cast<size_t *>(pointer) - 1;
+  heap_live -= *block;
+  std::free(block);
+}
+
+void operator delete(void *pointer, size_t) noexcept { operator delete(pointer); }
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_parses_name_uri_pairs() {
+  Collector collector;
+  TEST_ASSERT_TRUE(collector.parse(
+      "[{\"name\": \"Radio Paradise\", \"uri\": \"library://radio/12\"},\n"
+      " {\"uri\": \"spotify://playlist/x\", \"extra\": {\"name\": \"nested\", \"list\": [1, 2, {\"uri\": \"no\"}]},"
+      " \"name\": \"Chill\", \"count\": -1.5e3, \"ok\": null}]"));
+  TEST_ASSERT_EQUAL_size_t(2, collector.items.size());
+  TEST_ASSERT_EQUAL_STRING("Radio Paradise", collector.items[0].name.c_str());
+  TEST_ASSERT_EQUAL_STRING("library://radio/12", collector.items[0].uri.c_str());
+  TEST_ASSERT_EQUAL_STRING("Chill", collector.items[1].name.c_str());
+  TEST_ASSERT_EQUAL_STRING("spotify://playlist/x", collector.items[1].uri.c_str());
+  TEST_ASSERT_EQUAL_UINT32(2, collector.parser.get_items());
+  TEST_ASSERT_EQUAL_UINT32(0, collector.parser.get_skipped());
+}
+
+void test_incomplete_items_skipped() {
+  Collector collector;
+  TEST_ASSERT_TRUE(collector.parse(
+      "[{\"name\": \"No URI\"}, {\"name\": 5, \"uri\": \"x://1\"}, \"stray\", 7, "
+      "{\"names\": \"A\", \"uri\": \"x://2\"}, {\"name\": \"\", \"uri\": \"x://3\"}]"));
+  // Empty strings are still strings
+  TEST_ASSERT_EQUAL_size_t(1, collector.items.size());
+  TEST_ASSERT_EQUAL_STRING("x://3", collector.items[0].uri.c_str());
+  TEST_ASSERT_EQUAL_UINT32(3, collector.parser.get_skipped());
+}
+
+void test_escapes_and_unicode() {
+  Collector collector;
+  TEST_ASSERT_TRUE(collector.parse(
+      "[{\"name\": \"A \\\"B\\\" \\\\ \\/ \\u00e9 \\u20ac \\ud83d\\udcfb \\ud800x\", \"uri\": \"x://\\u0031\"}]"));
+  TEST_ASSERT_EQUAL_size_t(1, collector.items.size());
+  TEST_ASSERT_EQUAL_STRING("A \"B\" \\ / \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x93\xBB \xEF\xBF\xBDx",
+                           collector.items[0].name.c_str());
+  TEST_ASSERT_EQUAL_STRING("x://1", collector.items[0].uri.c_str());
+}
+
+void test_any_chunk_split() {
+  const std::string json = "[{\"name\": \"\\u00e9t\\u00e9\", \"uri\": \"x://a\"}, {\"uri\": \"x://b\", \"name\": \"B\"}]";
+  for (size_t split = 0; split <= json.size(); split++) {
+    Collector collector;
+    TEST_ASSERT_TRUE(collector.parser.feed(json.data(), split));
+    TEST_ASSERT_TRUE(collector.parser.feed(json.data() + split, json.size() - split));
+    TEST_ASSERT_TRUE(collector.parser.finish());
+    TEST_ASSERT_EQUAL_size_t(2, collector.items.size());
+    TEST_ASSERT_EQUAL_STRING("\xC3\xA9t\xC3\xA9", collector.items[0].name.c_str());
+    TEST_ASSERT_EQUAL_STRING("x://b", collector.items[1].uri.c_str());
+  }
+}
+
+void test_long_values() {
+  std::string long_name(FAVORITES_NAME_MAX - 1, 'n');
+  long_name += "\xC3\xA9 tail";  // Two-byte character straddles the limit
+  std::string long_uri(FAVORITES_URI_MAX + 1, 'u');
+  Collector collector;
+  TEST_ASSERT_TRUE(collector.parse("[{\"name\": \"" + long_name + "\", \"uri\": \"x://1\"}, {\"name\": \"L\", \"uri\": \"" +
+                                   long_uri + "\"}]"));
+  TEST_ASSERT_EQUAL_size_t(1, collector.items.size());
+  TEST_ASSERT_EQUAL_size_t(FAVORITES_NAME_MAX - 1, collector.items[0].name.size());
+  TEST_ASSERT_EQUAL_UINT32(1, collector.parser.get_truncated());
+  // A cut-off URI would play the wrong thing
+  TEST_ASSERT_EQUAL_UINT32(1, collector.parser.get_skipped());
+}
+
+void test_malformed_input() {
+  const char *bad[] = {
+      "",
+      "{\"name\": \"A\", \"uri\": \"x://1\"}",
+      "[{\"name\": \"A\", \"uri\": \"x://1\"}",
+      "[{\"name\": \"A\", \"uri\": \"x://1\"]]",
+      "[{\"name\": \"A\\q\"}]",
+      "[{\"name\": \"A\\u12g4\"}]",
+      "[] []",
+      "[{\"name\": \"A\nB\"}]",
+      "[@]",
+  };
+  for (const char *json : bad) {
+    Collector collector;
+    TEST_ASSERT_FALSE(collector.parse(json));
+    TEST_ASSERT_NOT_NULL(collector.parser.get_error());
+  }
+
+  // Items before the error were already delivered
+  Collector collector;
+  TEST_ASSERT_FALSE(collector.parse("[{\"name\": \"A\", \"uri\": \"x://1\"}, {\"name\": \"B\" \"uri\"}}"));
+  TEST_ASSERT_EQUAL_size_t(1, collector.items.size());
+  TEST_ASSERT_EQUAL_STRING("mismatched bracket", collector.parser.get_error());
+}
+
+void test_deep_nesting_rejected() {
+  std::string json = "[{\"x\": ";
+  for (int i = 0; i < FAVORITES_MAX_DEPTH; i++) {
+    json += "[";
+  }
+  Collector collector;
+  TEST_ASSERT_FALSE(collector.parse(json));
+  TEST_ASSERT_EQUAL_STRING("nested too deep", collector.parser.get_error());
+}
+
+void test_benchmark_payload_sizes() {
+  const int counts[] = {100, 1000, 5000};
+  for (int count : counts) {
+    std::string json = make_payload(count);
+    Collector collector;
+    collector.items.reserve(count);
+
+    // Parser working memory alone: no items stored
+    FavoritesParser counter(nullptr);
+    size_t before = heap_live;
+    heap_peak = heap_live;
+    auto start = std::chrono::steady_clock::now();
+    TEST_ASSERT_TRUE(counter.feed(json.data(), json.size()) && counter.finish());
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    size_t parser_peak = heap_peak - before;
+    TEST_ASSERT_EQUAL_UINT32(count, counter.get_items());
+
+    // Storing every item as it is parsed
+    before = heap_live;
+    heap_peak = heap_live;
+    TEST_ASSERT_TRUE(collector.parse(json));
+    size_t store_peak = heap_peak - before;
+    TEST_ASSERT_EQUAL_size_t(count, collector.items.size());
+
+    double us = std::chrono::duration<double, std::micro>(elapsed).count();
+    char message[192];
+    snprintf(message, sizeof(message),
+             "%5d items, %7u bytes JSON: %8.0f us (%.0f MB/s), parser %u bytes + %u heap, store peak %u bytes", count,
+             (unsigned) json.size(), us, json.size() / us, (unsigned) sizeof(FavoritesParser), (unsigned) parser_peak,
+             (unsigned) store_peak);
+    TEST_MESSAGE(message);
+    // Working memory doesn't grow with the payload
+    TEST_ASSERT_EQUAL_size_t(0, parser_peak);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_parses_name_uri_pairs);
+  RUN_TEST(test_incomplete_items_skipped);
+  RUN_TEST(test_escapes_and_unicode);
+  RUN_TEST(test_any_chunk_split);
+  RUN_TEST(test_long_values);
+  RUN_TEST(test_malformed_input);
+  RUN_TEST(test_deep_nesting_rejected);
+  RUN_TEST(test_benchmark_payload_sizes);
+
+  return UNITY_END();
+}
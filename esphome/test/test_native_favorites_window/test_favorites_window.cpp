@@ -0,0 +1,180 @@
+/**
+ * @file test_favorites_window.cpp
+ * @brief Unit tests for the favorites paging window
+ */
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "esphome/components/radio_controller/favorites_parser.h"
+#include "esphome/components/radio_controller/favorites_window.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+constexpr uint16_t PAGE = 4;
+
+StringArena *strings;
+FavoritesWindow *window;
+
+// `count` entries of the full list from `offset` on, named by position
+std::vector<PlaylistItem> page(uint32_t offset, size_t count) {
+  std::vector<PlaylistItem> items;
+  for (size_t i = 0; i < count; i++) {
+    std::string name = "Station " + std::to_string(offset + i);
+    items.push_back({strings->add(name), strings->add("library://radio/" + std::to_string(offset + i))});
+  }
+  return items;
+}
+
+bool add(uint32_t offset, size_t count, uint16_t limit = PAGE) {
+  auto items = page(offset, count);
+  return window->add_page(offset, limit, items, *strings);
+}
+
+// JSON for `count` entries from `offset` on, as Home Assistant sends a page
+std::string page_json(uint32_t offset, size_t count) {
+  std::string json = "[";
+  for (size_t i = 0; i < count; i++) {
+    std::string n = std::to_string(offset + i);
+    json += (i > 0 ? "," : "") + std::string("{\"name\":\"Station ") + n + "\",\"uri\":\"library://radio/" + n + "\"}";
+  }
+  return json + "]";
+}
+
+// Parses the way load_favorites_page does; false when the JSON is broken
+bool parse(const std::string &json, std::vector<PlaylistItem> &items) {
+  FavoritesParser parser([&items](const char *name, size_t name_length, const char *uri, size_t uri_length) {
+    items.push_back({strings->add(name, name_length), strings->add(uri, uri_length)});
+  });
+  return parser.feed(json.data(), json.size()) && parser.finish();
+}
+
+const char *name_at(size_t index) { return strings->c_str(window->get_items()[index].name); }
+
+}  // namespace
+
+void setUp(void) {
+  strings = new StringArena();
+  window = new FavoritesWindow();
+  window->set_max_size(2 * PAGE);
+}
+
+void tearDown(void) {
+  delete window;
+  delete strings;
+}
+
+void test_next_pages_append_and_trim_the_front() {
+  TEST_ASSERT_TRUE(add(0, PAGE));
+  TEST_ASSERT_TRUE(add(4, PAGE));
+  TEST_ASSERT_EQUAL_UINT32(0, window->get_offset());
+  TEST_ASSERT_EQUAL_UINT32(8, window->get_end());
+  TEST_ASSERT_TRUE(window->has_more_after());
+
+  size_t garbage = strings->get_garbage();
+  TEST_ASSERT_TRUE(add(8, PAGE));
+  TEST_ASSERT_EQUAL_UINT32(4, window->get_offset());
+  TEST_ASSERT_EQUAL_size_t(2 * PAGE, window->get_items().size());
+  TEST_ASSERT_EQUAL_STRING("Station 4", name_at(0));
+  TEST_ASSERT_EQUAL_STRING("Station 11", name_at(7));
+  // The dropped page's strings are released
+  TEST_ASSERT_GREATER_THAN(garbage, strings->get_garbage());
+}
+
+void test_previous_pages_prepend_and_trim_the_back() {
+  add(20, PAGE);
+  add(24, PAGE);
+  TEST_ASSERT_TRUE(add(16, PAGE));
+  TEST_ASSERT_EQUAL_UINT32(16, window->get_offset());
+  TEST_ASSERT_EQUAL_UINT32(24, window->get_end());
+  TEST_ASSERT_EQUAL_STRING("Station 16", name_at(0));
+  TEST_ASSERT_EQUAL_STRING("Station 23", name_at(7));
+}
+
+void test_short_page_against_its_own_limit() {
+  add(0, PAGE);
+  add(4, PAGE);
+  // A short backward page of the 2 entries before the window doesn't end the list
+  add(8, PAGE);
+  add(12, PAGE);
+  TEST_ASSERT_EQUAL_UINT32(8, window->get_offset());
+  TEST_ASSERT_TRUE(add(6, 2, 2));
+  TEST_ASSERT_EQUAL_UINT32(6, window->get_offset());
+  TEST_ASSERT_EQUAL_INT32(-1, window->get_total());
+  TEST_ASSERT_TRUE(window->has_more_after());
+
+  // Fewer than asked for: the list ends there
+  add(14, PAGE);
+  TEST_ASSERT_TRUE(add(18, 3));
+  TEST_ASSERT_EQUAL_INT32(21, window->get_total());
+  TEST_ASSERT_FALSE(window->has_more_after());
+}
+
+void test_stale_page_changes_nothing() {
+  add(0, PAGE);
+  add(4, PAGE);
+  size_t garbage = strings->get_garbage();
+  // The late answer to a retried request for a page that came in since
+  TEST_ASSERT_FALSE(add(4, PAGE));
+  TEST_ASSERT_EQUAL_UINT32(0, window->get_offset());
+  TEST_ASSERT_EQUAL_UINT32(8, window->get_end());
+  TEST_ASSERT_EQUAL_STRING("Station 4", name_at(4));
+  // Its own strings are released, the window's kept
+  TEST_ASSERT_GREATER_THAN(garbage, strings->get_garbage());
+  TEST_ASSERT_EQUAL_INT32(-1, window->get_total());
+}
+
+void test_unrelated_page_starts_over() {
+  add(0, PAGE);
+  add(4, PAGE);
+  TEST_ASSERT_TRUE(add(40, PAGE));
+  TEST_ASSERT_EQUAL_UINT32(40, window->get_offset());
+  TEST_ASSERT_EQUAL_size_t(PAGE, window->get_items().size());
+  TEST_ASSERT_EQUAL_STRING("Station 40", name_at(0));
+}
+
+void test_partial_page_does_not_set_total() {
+  add(0, PAGE);
+  // Cut off in transit after the first entry: read as a page it would be
+  // the short last one, so the controller drops it instead
+  std::string json = page_json(4, PAGE);
+  std::vector<PlaylistItem> items;
+  TEST_ASSERT_FALSE(parse(json.substr(0, json.find('}') + 2), items));
+  TEST_ASSERT_EQUAL_size_t(1, items.size());
+  TEST_ASSERT_EQUAL_INT32(-1, window->get_total());
+  TEST_ASSERT_TRUE(window->has_more_after());
+
+  // The retried request brings the whole page
+  items.clear();
+  TEST_ASSERT_TRUE(parse(json, items));
+  TEST_ASSERT_TRUE(window->add_page(4, PAGE, items, *strings));
+  TEST_ASSERT_EQUAL_UINT32(8, window->get_end());
+  TEST_ASSERT_EQUAL_INT32(-1, window->get_total());
+  TEST_ASSERT_TRUE(window->has_more_after());
+}
+
+void test_whole_list_has_nothing_after() {
+  add(8, PAGE);
+  auto all = page(0, 3);
+  window->load_all(all, *strings);
+  TEST_ASSERT_EQUAL_UINT32(0, window->get_offset());
+  TEST_ASSERT_EQUAL_INT32(3, window->get_total());
+  TEST_ASSERT_FALSE(window->has_more_after());
+  TEST_ASSERT_TRUE(all.empty());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_next_pages_append_and_trim_the_front);
+  RUN_TEST(test_previous_pages_prepend_and_trim_the_back);
+  RUN_TEST(test_short_page_against_its_own_limit);
+  RUN_TEST(test_stale_page_changes_nothing);
+  RUN_TEST(test_unrelated_page_starts_over);
+  RUN_TEST(test_partial_page_does_not_set_total);
+  RUN_TEST(test_whole_list_has_nothing_after);
+
+  return UNITY_END();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file test_glyph_cache.cpp
+ * @brief Tests and host benchmark for the compile-time column glyph cache
+ *
+ * The reference below is the previous row-based drawing path: one font
+ * lookup per glyph row, then a per-bit loop with the 3 - col reversal into
+ * a row-major brightness buffer.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "esphome/components/retrotext_display/retrotext_display.h"
+
+using namespace esphome;
+using namespace esphome::retrotext_display;
+
+namespace {
+
+class TestDisplay : public RetroTextDisplay {
+ public:
+  void draw(const uint8_t *glyphs, int count, uint8_t brightness) {
+    this->clear_framebuffer_();
+    for (int i = 0; i < count; i++) {
+      this->draw_character_(glyphs[i], i * GLYPH_WIDTH, brightness);
+    }
+  }
+  uint8_t pixel(int x, int y) const {
+    return (this->columns_[x] & (1 << y)) ? this->column_brightness_[x] : 0;
+  }
+};
+
+// Previous implementation: RetroTextDisplay::get_glyph_row_()
+uint8_t reference_glyph_row(uint8_t glyph_index, int row) {
+  if (glyph_index < 32 || (glyph_index > 126 && glyph_index < 128) || glyph_index > 159) {
+    return 0x00;
+  }
+  uint8_t char_index = glyph_index <= 126 ? glyph_index - 32 : 95 + (glyph_index - 127);
+  return modern_font4x6[3 + (char_index * 6) + row];
+}
+
+// Previous implementation: draw_character_() with set_pixel_() into a row-major buffer
+void reference_draw(uint8_t *buffer, uint8_t glyph_index, int x_offset, uint8_t brightness) {
+  for (int row = 0; row < 6; row++) {
+    uint8_t glyph_row = reference_glyph_row(glyph_index, row);
+    for (int col = 0; col < 4; col++) {
+      if (glyph_row & (0x10 << col)) {
+        int x_pos = x_offset + (3 - col);
+        if (x_pos >= 0 && x_pos < 72) {
+          buffer[row * 72 + x_pos] = brightness;
+        }
+      }
+    }
+  }
+}
+
+TestDisplay *display;
+
+}  // namespace
+
+void setUp(void) { display = new TestDisplay(); }
+void tearDown(void) { delete display; }
+
+void test_cache_matches_font_rows() {
+  for (int glyph = 0; glyph < 256; glyph++) {
+    const uint8_t *columns = glyph_columns(glyph);
+    for (int row = 0; row < GLYPH_HEIGHT; row++) {
+      uint8_t expected = reference_glyph_row(glyph, row) & 0xF0;
+      uint8_t actual = 0;
+      for (int col = 0; col < GLYPH_WIDTH; col++) {
+        if (columns[col] & (1 << row)) {
+          actual |= 0x80 >> col;
+        }
+      }
+      TEST_ASSERT_EQUAL_HEX8(expected, actual);
+    }
+  }
+}
+
+void test_unsupported_glyphs_blank() {
+  const uint8_t unsupported[] = {0, 31, 127, 160, 255};
+  for (uint8_t glyph : unsupported) {
+    const uint8_t *columns = glyph_columns(glyph);
+    for (int col = 0; col < GLYPH_WIDTH; col++) {
+      TEST_ASSERT_EQUAL_HEX8(0, columns[col]);
+    }
+  }
+}
+
+void test_blit_matches_reference_draw() {
+  uint8_t glyphs[18];
+  for (int start = 32; start < 160; start += 18) {
+    uint8_t expected[DISPLAY_PIXELS] = {};
+    for (int i = 0; i < 18; i++) {
+      glyphs[i] = start + i;
+      reference_draw(expected, glyphs[i], i * 4, 100);
+    }
+    display->draw(glyphs, 18, 100);
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+      for (int x = 0; x < DISPLAY_WIDTH; x++) {
+        TEST_ASSERT_EQUAL(expected[y * 72 + x], display->pixel(x, y));
+      }
+    }
+  }
+}
+
+void test_benchmark_full_screen_text() {
+  const int frames = 100000;
+  uint8_t glyphs[18];
+  const char *text = "THE QUICK BROWN FO";
+  for (int i = 0; i < 18; i++) {
+    glyphs[i] = text[i];
+  }
+  uint8_t buffer[DISPLAY_PIXELS];
+  volatile uint8_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) {
+    memset(buffer, 0, sizeof(buffer));
+    for (int i = 0; i < 18; i++) {
+      reference_draw(buffer, glyphs[(i + f) % 18], i * 4, 128);
+    }
+    sink = sink + buffer[f % DISPLAY_PIXELS];
+  }
+  auto before = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) {
+    glyphs[f % 18] = text[(f + 1) % 18];
+    display->draw(glyphs, 18, 128);
+    sink = sink + display->pixel(f % DISPLAY_WIDTH, f % DISPLAY_HEIGHT);
+  }
+  auto after = std::chrono::steady_clock::now() - start;
+
+  double before_ns = std::chrono::duration<double, std::nano>(before).count() / frames;
+  double after_ns = std::chrono::duration<double, std::nano>(after).count() / frames;
+  char message[128];
+  snprintf(message, sizeof(message), "18-character text render: %.0f ns/frame before, %.0f ns/frame after (%.1fx)",
+           before_ns, after_ns, before_ns / after_ns);
+  TEST_MESSAGE(message);
+  (void) sink;
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_cache_matches_font_rows);
+  RUN_TEST(test_unsupported_glyphs_blank);
+  RUN_TEST(test_blit_matches_reference_draw);
+  RUN_TEST(test_benchmark_full_screen_text);
+  return UNITY_END();
+}
@@ -0,0 +1,227 @@
+/**
+ * @file test_i2c_arbiter.cpp
+ * @brief Unit tests for the I2C bus arbiter
+ *
+ * Scheduling is checked with scripted jobs; the display and keypad run on
+ * the simulated bus to show key events being read between frame chunks.
+ */
+
+#include <unity.h>
+#include <vector>
+#include "esphome/components/i2c_arbiter/i2c_arbiter.h"
+#include "esphome/components/retrotext_display/retrotext_display.h"
+#include "esphome/components/tca8418_keypad/tca8418_keypad.h"
+#include "i2c_sim/is31fl3737_model.h"
+#include "i2c_sim/simulated_bus.h"
+#include "i2c_sim/tca8418_model.h"
+
+using namespace esphome;
+using namespace esphome::i2c_arbiter;
+using namespace i2c_sim;
+
+namespace {
+
+constexpr uint8_t BOARD_ADDRESSES[3] = {0x50, 0x5A, 0x5F};
+constexpr uint8_t KEYPAD_ADDRESS = 0x34;
+
+I2CArbiter *arbiter;
+SimulatedBus *bus;
+
+// A job of `steps` chunks that logs each step under `name`
+BulkStep scripted_job(std::vector<char> &log, char name, int steps, uint32_t step_us = 0) {
+  auto remaining = std::make_shared<int>(steps);
+  return [&log, name, remaining, step_us]() {
+    log.push_back(name);
+    host_time::advance_us(step_us);
+    return --*remaining == 0;
+  };
+}
+
+uint32_t display_transactions() {
+  uint32_t total = 0;
+  for (uint8_t address : BOARD_ADDRESSES) {
+    total += bus->device_stats(address).transactions;
+  }
+  return total;
+}
+
+}  // namespace
+
+void setUp(void) {
+  host_time::reset();
+  arbiter = new I2CArbiter();
+  arbiter->setup();
+  bus = new SimulatedBus();
+  bus->set_clock_frequency(I2C_FAST_MODE_HZ);
+}
+
+void tearDown(void) {
+  delete bus;
+  delete arbiter;
+}
+
+void test_jobs_step_round_robin() {
+  std::vector<char> log;
+  arbiter->set_budget(0);
+  arbiter->submit_bulk(scripted_job(log, 'A', 3));
+  arbiter->submit_bulk(scripted_job(log, 'B', 1));
+  TEST_ASSERT_EQUAL_size_t(2, arbiter->get_queue_depth());
+
+  arbiter->loop();
+
+  // The one-chunk job doesn't wait for the three-chunk one to finish
+  TEST_ASSERT_EQUAL_STRING("ABAA", std::string(log.begin(), log.end()).c_str());
+  TEST_ASSERT_EQUAL_size_t(0, arbiter->get_queue_depth());
+  const I2CArbiterStats &stats = arbiter->get_stats();
+  TEST_ASSERT_EQUAL_UINT32(2, stats.jobs_submitted);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.jobs_completed);
+  TEST_ASSERT_EQUAL_UINT32(4, stats.chunks);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.queue_depth_max);
+}
+
+void test_urgent_polls_run_before_every_chunk() {
+  std::vector<char> log;
+  arbiter->set_budget(0);
+  arbiter->add_urgent_poller([&log]() { log.push_back('k'); });
+  arbiter->submit_bulk(scripted_job(log, 'D', 3));
+
+  arbiter->loop();
+  TEST_ASSERT_EQUAL_STRING("kDkDkD", std::string(log.begin(), log.end()).c_str());
+  TEST_ASSERT_EQUAL_UINT32(3, arbiter->get_stats().cut_ins);
+
+  // Nothing queued: the keypad's own loop does the polling
+  arbiter->loop();
+  TEST_ASSERT_EQUAL_size_t(6, log.size());
+}
+
+void test_budget_leaves_remaining_chunks_for_next_loop() {
+  std::vector<char> log;
+  arbiter->set_budget(2000);
+  arbiter->submit_bulk(scripted_job(log, 'D', 5, 800));
+
+  arbiter->loop();  // 800, 1600, 2400 us: the third chunk uses up the budget
+  TEST_ASSERT_EQUAL_size_t(3, log.size());
+  TEST_ASSERT_EQUAL_size_t(1, arbiter->get_queue_depth());
+
+  arbiter->loop();
+  TEST_ASSERT_EQUAL_size_t(5, log.size());
+  TEST_ASSERT_EQUAL_size_t(0, arbiter->get_queue_depth());
+}
+
+void test_wait_time_and_sensors() {
+  std::vector<char> log;
+  sensor::Sensor queue_depth;
+  sensor::Sensor wait;
+  sensor::Sensor wait_max;
+  sensor::Sensor cut_ins;
+  arbiter->set_sensor(METRIC_QUEUE_DEPTH, &queue_depth);
+  arbiter->set_sensor(METRIC_WAIT, &wait);
+  arbiter->set_sensor(METRIC_WAIT_MAX, &wait_max);
+  arbiter->set_sensor(METRIC_CUT_INS, &cut_ins);
+
+  arbiter->submit_bulk(scripted_job(log, 'A', 2));
+  host_time::advance_us(300);
+  arbiter->submit_bulk(scripted_job(log, 'B', 1));
+  host_time::advance_us(500);
+  arbiter->loop();
+
+  // Waits are counted to the first chunk only: A 800 us, B 500 us
+  TEST_ASSERT_EQUAL_UINT32(800, arbiter->get_stats().wait_max_us);
+  TEST_ASSERT_EQUAL_UINT32(650, arbiter->get_stats().wait_avg_us());
+
+  host_time::advance_us(1000000 - micros());
+  arbiter->update();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 2.0, queue_depth.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.5, 650.0, wait.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.5, 800.0, wait_max.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 3.0, cut_ins.state);
+
+  // Empty window
+  host_time::advance_ms(1000);
+  arbiter->update();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, queue_depth.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, wait_max.state);
+  TEST_ASSERT_EQUAL_UINT32(2, arbiter->get_stats().jobs_completed);
+}
+
+void test_key_events_cut_in_between_display_chunks() {
+  IS31FL3737Model boards[3];
+  TCA8418Model keypad_chip;
+  for (uint8_t i = 0; i < 3; i++) {
+    bus->attach(BOARD_ADDRESSES[i], &boards[i]);
+  }
+  bus->attach(KEYPAD_ADDRESS, &keypad_chip);
+  arbiter->set_budget(0);
+
+  tca8418_keypad::TCA8418Component keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.set_matrix_size(4, 10);
+  keypad.set_i2c_arbiter(arbiter);
+  keypad.setup();
+
+  retrotext_display::RetroTextDisplay display;
+  display.set_i2c_bus(bus);
+  display.set_board_addresses(BOARD_ADDRESSES[0], BOARD_ADDRESSES[1], BOARD_ADDRESSES[2]);
+  display.set_i2c_arbiter(arbiter);
+  display.setup();
+
+  // First frame: full 192-byte image per board, handed to the arbiter
+  host_time::advance_ms(20);
+  display.loop();
+  uint32_t fence = display.get_frame_fence();
+  TEST_ASSERT_EQUAL_size_t(1, arbiter->get_queue_depth());
+  TEST_ASSERT_FALSE(display.is_frame_complete(fence));
+
+  // A key lands on the chip after every chunk; each is read before the next chunk
+  tca8418_keypad::KeyEventQueue key_events;
+  keypad.add_event_queue(&key_events);
+  std::vector<uint32_t> pressed_us;
+  size_t callbacks = 0;
+  keypad.add_on_key_press_callback([&callbacks](uint8_t, uint8_t, uint8_t) { callbacks++; });
+  auto presses = std::make_shared<uint8_t>(0);
+  arbiter->submit_bulk([&pressed_us, &keypad_chip, presses]() {
+    pressed_us.push_back(micros());
+    keypad_chip.press(0, *presses);
+    return ++*presses == 5;
+  });
+
+  bus->reset_stats();
+  arbiter->loop();
+
+  TEST_ASSERT_TRUE(display.is_frame_complete(fence));
+  TEST_ASSERT_EQUAL_UINT8(0, keypad_chip.fifo_count());
+  // The frame went out as chunks, not one blocking push
+  TEST_ASSERT_GREATER_THAN_UINT32(5, arbiter->get_stats().chunks);
+  // One bus write per display chunk (the other five chunks were the presses),
+  // plus an unlock and PWM page select per board
+  TEST_ASSERT_EQUAL_UINT32(arbiter->get_stats().chunks - 5 + 3 * 2, display_transactions());
+
+  // Read-time stamps: only the keypad's own transactions (well under one
+  // 64-byte display chunk, ~1.5 ms at 400 kHz) between press and read
+  TEST_ASSERT_EQUAL_UINT16(5, key_events.size());
+  for (uint8_t i = 0; i < 5; i++) {
+    tca8418_keypad::TimedKeyEvent event;
+    TEST_ASSERT_TRUE(key_events.pop(&event));
+    TEST_ASSERT_EQUAL_UINT8(i, event.col);
+    TEST_ASSERT_TRUE(event.press);
+    TEST_ASSERT_LESS_THAN_UINT32(1000, event.timestamp_us - pressed_us[i]);
+  }
+
+  // Callbacks wait for the keypad's own loop instead of running between chunks
+  TEST_ASSERT_EQUAL_size_t(0, callbacks);
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(5, callbacks);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_jobs_step_round_robin);
+  RUN_TEST(test_urgent_polls_run_before_every_chunk);
+  RUN_TEST(test_budget_leaves_remaining_chunks_for_next_loop);
+  RUN_TEST(test_wait_time_and_sensors);
+  RUN_TEST(test_key_events_cut_in_between_display_chunks);
+
+  return UNITY_END();
+}
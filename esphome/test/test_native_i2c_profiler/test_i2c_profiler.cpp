@@ -0,0 +1,182 @@
+/**
+ * @file test_i2c_profiler.cpp
+ * @brief Unit tests for the I2C bus profiler
+ *
+ * The profiler wraps a simulated bus that advances the host clock by the
+ * wire time of each transaction, so measured latencies match 400 kHz.
+ */
+
+#include <unity.h>
+#include "esphome/components/i2c_profiler/i2c_profiler.h"
+#include "esphome/components/retrotext_display/retrotext_display.h"
+#include "i2c_sim/is31fl3737_model.h"
+#include "i2c_sim/simulated_bus.h"
+
+using namespace esphome;
+using namespace esphome::i2c_profiler;
+using namespace i2c_sim;
+
+namespace {
+
+SimulatedBus *bus;
+IS31FL3737Model *chip;
+I2CProfiler *profiler;
+
+void write_bytes(uint8_t address, size_t len) {
+  uint8_t data[64] = {};
+  profiler->write(address, data, len);
+}
+
+}  // namespace
+
+void setUp(void) {
+  host_time::reset();
+  bus = new SimulatedBus();
+  bus->set_clock_frequency(I2C_FAST_MODE_HZ);
+  chip = new IS31FL3737Model();
+  bus->attach(0x50, chip);
+  profiler = new I2CProfiler();
+  profiler->set_bus(bus);
+  profiler->setup();
+}
+
+void tearDown(void) {
+  delete profiler;
+  delete chip;
+  delete bus;
+}
+
+void test_records_transactions_per_address() {
+  write_bytes(0x50, 2);
+  write_bytes(0x50, 2);
+  uint8_t value = 0;
+  TEST_ASSERT_EQUAL(i2c::ERROR_OK, profiler->read(0x50, &value, 1));
+
+  const I2CDeviceProfile *profile = profiler->get_device_profile(0x50);
+  TEST_ASSERT_NOT_NULL(profile);
+  TEST_ASSERT_EQUAL_UINT32(3, profile->total.transactions);
+  TEST_ASSERT_EQUAL_UINT32(2, profile->total.writes);
+  TEST_ASSERT_EQUAL_UINT32(1, profile->total.reads);
+  TEST_ASSERT_EQUAL(5, profile->total.bytes);
+  TEST_ASSERT_EQUAL_UINT32(3, profiler->get_bus_profile().total.transactions);
+  // Everything reached the real bus
+  TEST_ASSERT_EQUAL_UINT32(3, bus->stats().transactions);
+  TEST_ASSERT_NULL(profiler->get_device_profile(0x34));
+}
+
+void test_counts_nacks() {
+  uint8_t data[2] = {0x00, 0x01};
+  TEST_ASSERT_EQUAL(i2c::ERROR_NOT_ACKNOWLEDGED, profiler->write(0x34, data, 2));
+  TEST_ASSERT_EQUAL_UINT32(1, profiler->get_device_profile(0x34)->total.nacks);
+  TEST_ASSERT_EQUAL_UINT32(1, profiler->get_bus_profile().total.nacks);
+}
+
+void test_latency_histogram() {
+  // 2 bytes at 400 kHz: 29 bits = 72 us → < 128 us bucket
+  write_bytes(0x50, 2);
+  // 64 bytes: 587 bits = 1467 us → < 2048 us bucket
+  write_bytes(0x50, 64);
+
+  const I2CTrafficStats &stats = profiler->get_device_profile(0x50)->total;
+  TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[2]);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[6]);
+  TEST_ASSERT_UINT32_WITHIN(1, 1467, stats.latency_max_us);
+  TEST_ASSERT_UINT32_WITHIN(1, (72 + 1467) / 2, stats.latency_avg_us());
+  TEST_ASSERT_EQUAL_UINT32(128, stats.latency_percentile_us(50));
+  TEST_ASSERT_EQUAL_UINT32(2048, stats.latency_percentile_us(95));
+}
+
+void test_update_publishes_window_rates() {
+  sensor::Sensor transactions;
+  sensor::Sensor utilization;
+  sensor::Sensor device_bytes;
+  sensor::Sensor device_latency;
+  profiler->set_sensor(METRIC_TRANSACTIONS, &transactions);
+  profiler->set_sensor(METRIC_UTILIZATION, &utilization);
+  profiler->set_device_sensor(0x50, METRIC_BYTES, &device_bytes);
+  profiler->set_device_sensor(0x50, METRIC_LATENCY, &device_latency);
+
+  // 10 × 64-byte writes (~14.7 ms of bus time) in a 1 s window
+  for (int i = 0; i < 10; i++) {
+    write_bytes(0x50, 64);
+  }
+  host_time::advance_us(1000000 - micros());
+  profiler->update();
+
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 10.0, transactions.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 640.0, device_bytes.state);
+  TEST_ASSERT_FLOAT_WITHIN(2, 1467, device_latency.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.05, 1.47, utilization.state);
+
+  // Next window is empty, lifetime totals are kept
+  host_time::advance_ms(1000);
+  profiler->update();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, transactions.state);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, utilization.state);
+  TEST_ASSERT_EQUAL_UINT32(10, profiler->get_bus_profile().total.transactions);
+}
+
+void test_nack_sensor_is_cumulative() {
+  sensor::Sensor nacks;
+  profiler->set_device_sensor(0x34, METRIC_NACKS, &nacks);
+  write_bytes(0x34, 1);
+  host_time::advance_ms(10);
+  profiler->update();
+  host_time::advance_ms(10);
+  profiler->update();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 1.0, nacks.state);
+}
+
+void test_untracked_addresses_beyond_limit() {
+  for (uint8_t address = 0x10; address < 0x10 + I2C_PROFILER_MAX_DEVICES + 2; address++) {
+    write_bytes(address, 1);
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, profiler->get_untracked_transactions());
+  TEST_ASSERT_EQUAL_UINT32(I2C_PROFILER_MAX_DEVICES + 2, profiler->get_bus_profile().total.transactions);
+}
+
+void test_setup_fails_without_bus() {
+  I2CProfiler unwired;
+  unwired.setup();
+  TEST_ASSERT_TRUE(unwired.is_failed());
+  uint8_t data = 0;
+  TEST_ASSERT_EQUAL(i2c::ERROR_NOT_INITIALIZED, unwired.write(0x50, &data, 1));
+}
+
+void test_profiles_display_traffic() {
+  IS31FL3737Model boards[2];
+  bus->attach(0x5A, &boards[0]);
+  bus->attach(0x5F, &boards[1]);
+
+  retrotext_display::RetroTextDisplay display;
+  display.set_i2c_bus(profiler);
+  display.set_board_addresses(0x50, 0x5A, 0x5F);
+  display.setup();
+  for (int i = 0; i < 50; i++) {
+    host_time::advance_ms(1);
+    display.loop();
+  }
+
+  for (uint8_t address : {0x50, 0x5A, 0x5F}) {
+    const I2CDeviceProfile *profile = profiler->get_device_profile(address);
+    TEST_ASSERT_NOT_NULL(profile);
+    TEST_ASSERT_EQUAL_UINT32(bus->device_stats(address).transactions, profile->total.transactions);
+    TEST_ASSERT_EQUAL(bus->device_stats(address).bytes, profile->total.bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, profile->total.nacks);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_records_transactions_per_address);
+  RUN_TEST(test_counts_nacks);
+  RUN_TEST(test_latency_histogram);
+  RUN_TEST(test_update_publishes_window_rates);
+  RUN_TEST(test_nack_sensor_is_cumulative);
+  RUN_TEST(test_untracked_addresses_beyond_limit);
+  RUN_TEST(test_setup_fails_without_bus);
+  RUN_TEST(test_profiles_display_traffic);
+
+  return UNITY_END();
+}
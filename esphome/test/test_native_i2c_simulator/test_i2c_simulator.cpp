@@ -0,0 +1,817 @@
+/**
+ * @file test_i2c_simulator.cpp
+ * @brief Components against the simulated I2C bus and chip register models
+ *
+ * Checks that what the display and keypad components send ends up in the
+ * right chip registers, and reports bus traffic and wire time per display
+ * frame at 100 kHz, 400 kHz and 1 MHz.
+ */
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "esphome/components/retrotext_display/retrotext_display.h"
+#include "esphome/components/tca8418_keypad/tca8418_keypad.h"
+#include "i2c_sim/is31fl3737_model.h"
+#include "i2c_sim/simulated_bus.h"
+#include "i2c_sim/simulated_pin.h"
+#include "i2c_sim/tca8418_model.h"
+
+using namespace esphome;
+using namespace esphome::retrotext_display;
+using namespace i2c_sim;
+
+namespace {
+
+constexpr uint8_t BOARD_ADDRESSES[DISPLAY_BOARDS] = {0x50, 0x5A, 0x5F};
+constexpr uint8_t KEYPAD_ADDRESS = 0x34;
+
+class TestDisplay : public RetroTextDisplay {
+ public:
+  uint8_t pixel(int x, int y) const {
+    return (this->columns_[x] & (1 << y)) ? this->column_brightness_[x] : 0;
+  }
+};
+
+class TestKeypad : public tca8418_keypad::TCA8418Component {
+ public:
+  struct Event {
+    uint8_t row;
+    uint8_t col;
+    bool press;
+  };
+  std::vector<Event> events;
+
+  TestKeypad() {
+    this->add_on_key_press_callback([this](uint8_t row, uint8_t col, uint8_t) { events.push_back({row, col, true}); });
+    this->add_on_key_release_callback(
+        [this](uint8_t row, uint8_t col, uint8_t) { events.push_back({row, col, false}); });
+  }
+};
+
+SimulatedBus *bus;
+IS31FL3737Model *boards[DISPLAY_BOARDS];
+TCA8418Model *keypad_chip;
+
+// Write one register on the currently selected page
+void write_reg(uint8_t address, uint8_t reg, uint8_t value) {
+  uint8_t data[2] = {reg, value};
+  bus->write(address, data, 2);
+}
+
+uint8_t read_reg(uint8_t address, uint8_t reg) {
+  uint8_t value = 0;
+  bus->write_readv(address, &reg, 1, &value, 1);
+  return value;
+}
+
+void select_page(uint8_t address, uint8_t page) {
+  write_reg(address, 0xFE, 0xC5);
+  write_reg(address, 0xFD, page);
+}
+
+// Run the display until everything rendered so far is on the chips
+void run_display_until_complete(TestDisplay &display) {
+  uint32_t fence = display.get_frame_fence();
+  for (int i = 0; i < 1000 && !display.is_frame_complete(fence); i++) {
+    host_time::advance_ms(1);
+    display.loop();
+  }
+  TEST_ASSERT_TRUE(display.is_frame_complete(fence));
+}
+
+// Every logical pixel shows on its chip with the framebuffer brightness
+void assert_chips_match_display(const TestDisplay &display) {
+  for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+    for (uint8_t y = 0; y < DISPLAY_HEIGHT; y++) {
+      const PixelRegister &p = PIXEL_MAP.pixels[x * DISPLAY_HEIGHT + y];
+      TEST_ASSERT_EQUAL_UINT8(display.pixel(x, y), boards[p.board]->output(p.reg));
+    }
+  }
+}
+
+}  // namespace
+
+void setUp(void) {
+  host_time::reset();
+  bus = new SimulatedBus();
+  for (uint8_t i = 0; i < DISPLAY_BOARDS; i++) {
+    boards[i] = new IS31FL3737Model();
+    bus->attach(BOARD_ADDRESSES[i], boards[i]);
+  }
+  keypad_chip = new TCA8418Model();
+  bus->attach(KEYPAD_ADDRESS, keypad_chip);
+}
+
+void tearDown(void) {
+  for (auto *board : boards) {
+    delete board;
+  }
+  delete keypad_chip;
+  delete bus;
+}
+
+// ============================================================================
+// Bus
+// ============================================================================
+
+void test_bus_nacks_missing_device() {
+  uint8_t data[2] = {0x00, 0x01};
+  TEST_ASSERT_EQUAL(i2c::ERROR_NOT_ACKNOWLEDGED, bus->write(0x20, data, 2));
+  TEST_ASSERT_EQUAL(i2c::ERROR_OK, bus->write(0x50, data, 2));
+
+  bus->set_nack(0x50, true);
+  TEST_ASSERT_EQUAL(i2c::ERROR_NOT_ACKNOWLEDGED, bus->write(0x50, data, 2));
+
+  TEST_ASSERT_EQUAL_UINT32(3, bus->stats().transactions);
+  TEST_ASSERT_EQUAL_UINT32(2, bus->stats().nacks);
+  TEST_ASSERT_EQUAL_UINT32(1, bus->device_stats(0x20).nacks);
+  // Only the acknowledged write clocked its data bytes
+  TEST_ASSERT_EQUAL(2, bus->stats().bytes);
+}
+
+void test_bus_counts_wire_time() {
+  uint8_t data[2] = {0x00, 0x01};
+  bus->write(0x50, data, 2);
+
+  // START + address + 2 data bytes (9 bits each with ACK) + STOP
+  TEST_ASSERT_EQUAL(29, bus->stats().bits);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 290.0, bus->stats().time_us(I2C_STANDARD_MODE_HZ));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 72.5, bus->stats().time_us(I2C_FAST_MODE_HZ));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 29.0, bus->stats().time_us(I2C_FAST_MODE_PLUS_HZ));
+}
+
+void test_bus_advances_host_clock() {
+  bus->set_clock_frequency(I2C_FAST_MODE_HZ);
+  uint8_t data[2] = {0x00, 0x01};
+  for (int i = 0; i < 4; i++) {
+    bus->write(0x50, data, 2);
+  }
+  // 4 × 72.5 us, with the half microseconds carried over
+  TEST_ASSERT_EQUAL_UINT32(290, micros());
+}
+
+// ============================================================================
+// IS31FL3737 model
+// ============================================================================
+
+void test_is31fl3737_page_select_requires_unlock() {
+  write_reg(0x50, 0xFD, 0x01);
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->page());
+  TEST_ASSERT_EQUAL_UINT32(1, boards[0]->locked_command_writes());
+
+  select_page(0x50, 0x01);
+  TEST_ASSERT_EQUAL_UINT8(1, boards[0]->page());
+
+  // The unlock is good for one command write only
+  write_reg(0x50, 0xFD, 0x03);
+  TEST_ASSERT_EQUAL_UINT8(1, boards[0]->page());
+  TEST_ASSERT_EQUAL_UINT32(2, boards[0]->locked_command_writes());
+}
+
+void test_is31fl3737_burst_write_auto_increments() {
+  select_page(0x50, 0x01);
+  uint8_t data[4] = {0x10, 11, 22, 33};
+  bus->write(0x50, data, 4);
+  TEST_ASSERT_EQUAL_UINT8(11, boards[0]->pwm(0x10));
+  TEST_ASSERT_EQUAL_UINT8(22, boards[0]->pwm(0x11));
+  TEST_ASSERT_EQUAL_UINT8(33, boards[0]->pwm(0x12));
+  TEST_ASSERT_EQUAL_UINT8(22, read_reg(0x50, 0x11));
+  // Other boards are untouched
+  TEST_ASSERT_EQUAL_UINT8(0, boards[1]->pwm(0x10));
+}
+
+void test_is31fl3737_drops_read_only_writes() {
+  // LED open/short registers on page 0 are read-only
+  select_page(0x50, 0x00);
+  write_reg(0x50, 0x18, 0xFF);
+  TEST_ASSERT_EQUAL_UINT8(0, read_reg(0x50, 0x18));
+  TEST_ASSERT_EQUAL_UINT32(1, boards[0]->dropped_writes());
+}
+
+void test_is31fl3737_reset_register_restores_defaults() {
+  select_page(0x50, 0x01);
+  write_reg(0x50, 0x00, 0x80);
+  select_page(0x50, 0x03);
+  write_reg(0x50, 0x00, 0x01);
+  TEST_ASSERT_FALSE(boards[0]->is_shutdown());
+
+  read_reg(0x50, 0x11);
+  TEST_ASSERT_EQUAL_UINT32(1, boards[0]->resets());
+  TEST_ASSERT_TRUE(boards[0]->is_shutdown());
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->pwm(0x00));
+}
+
+void test_is31fl3737_output_needs_led_enable_and_normal_operation() {
+  select_page(0x50, 0x01);
+  write_reg(0x50, 0x23, 200);  // SW3, CS4
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->output(0x23));
+
+  select_page(0x50, 0x00);
+  write_reg(0x50, 0x04, 0x08);  // SW3 low byte, CS4 bit
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->output(0x23));
+
+  select_page(0x50, 0x03);
+  write_reg(0x50, 0x00, 0x01);
+  TEST_ASSERT_EQUAL_UINT8(200, boards[0]->output(0x23));
+}
+
+// ============================================================================
+// IS31FL3737Driver on the model
+// ============================================================================
+
+void test_driver_begin_configures_chip() {
+  IS31FL3737Driver driver;
+  TEST_ASSERT_TRUE(driver.begin(0x50, bus));
+
+  TEST_ASSERT_EQUAL_UINT32(1, boards[0]->resets());
+  for (uint8_t reg = 0; reg < 0x18; reg++) {
+    TEST_ASSERT_EQUAL_HEX8(0xFF, boards[0]->led_control(reg));
+  }
+  TEST_ASSERT_FALSE(boards[0]->is_shutdown());
+  TEST_ASSERT_EQUAL_UINT8(128, boards[0]->global_current());
+  TEST_ASSERT_EQUAL_UINT8(1, boards[0]->page());
+  TEST_ASSERT_EQUAL_UINT32(0, boards[0]->locked_command_writes());
+  TEST_ASSERT_EQUAL_UINT32(0, boards[0]->dropped_writes());
+}
+
+void test_driver_frames_match_chip_registers() {
+  IS31FL3737Driver driver;
+  driver.begin(0x50, bus);
+
+  for (uint8_t i = 0; i < 12; i++) {
+    driver.set_pixel(i, i, 10 + i);
+    driver.set_pixel(11 - i, i, 100 + i);
+  }
+  driver.show();
+  TEST_ASSERT_EQUAL_MEMORY(driver.register_image(), boards[0]->pwm_page(), IS31FL3737_PWM_REGISTER_SIZE);
+
+  // Incremental frame: only a few registers change
+  driver.set_pixel(3, 3, 0);
+  driver.set_pixel(7, 9, 255);
+  driver.show();
+  TEST_ASSERT_EQUAL_MEMORY(driver.register_image(), boards[0]->pwm_page(), IS31FL3737_PWM_REGISTER_SIZE);
+
+  // Global current goes to the function page and PWM frames still land on page 1
+  driver.set_global_current(64);
+  TEST_ASSERT_EQUAL_UINT8(64, boards[0]->global_current());
+  driver.set_pixel(0, 0, 1);
+  driver.show();
+  TEST_ASSERT_EQUAL_UINT8(1, boards[0]->pwm(0x00));
+  TEST_ASSERT_EQUAL_UINT32(0, boards[0]->dropped_writes());
+}
+
+// ============================================================================
+// Auto breath (ABM)
+// ============================================================================
+
+void test_abm_timing_codes() {
+  TEST_ASSERT_EQUAL_UINT8(0, is31fl3737_abm_ramp_code(0));
+  TEST_ASSERT_EQUAL_UINT8(0, is31fl3737_abm_ramp_code(210));
+  TEST_ASSERT_EQUAL_UINT8(2, is31fl3737_abm_ramp_code(1000));  // 840 ms is nearer than 1680 ms
+  TEST_ASSERT_EQUAL_UINT8(3, is31fl3737_abm_ramp_code(1680));
+  TEST_ASSERT_EQUAL_UINT8(7, is31fl3737_abm_ramp_code(60000));
+  TEST_ASSERT_EQUAL_UINT8(0, is31fl3737_abm_hold_code(50));
+  TEST_ASSERT_EQUAL_UINT8(1, is31fl3737_abm_hold_code(210));
+  TEST_ASSERT_EQUAL_UINT8(8, is31fl3737_abm_hold_code(100000));
+  TEST_ASSERT_EQUAL_UINT8(10, is31fl3737_abm_hold_code(200000, IS31FL3737_ABM_OFF_MAX_CODE));
+}
+
+void test_breath_fade_in_runs_without_bus_traffic() {
+  IS31FL3737Driver driver;
+  driver.begin(0x50, bus);
+  driver.set_pixel(9, 2, 200);
+  driver.show();
+
+  TEST_ASSERT_TRUE(driver.set_breath(1, IS31FL3737Breath::fade_in(1680)));
+  TEST_ASSERT_TRUE(driver.set_led_mode(9, 2, 1));
+  TEST_ASSERT_TRUE(driver.start_breath());
+  uint8_t reg = is31fl3737_pwm_register(9, 2);
+  TEST_ASSERT_TRUE(boards[0]->is_breath_enabled());
+  TEST_ASSERT_EQUAL_UINT8(1, boards[0]->abm(reg));
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->output(reg));
+
+  // The chip does the fade; the driver has nothing to send
+  bus->reset_stats();
+  uint8_t previous = 0;
+  for (int ms = 0; ms < 3000; ms += 25) {
+    host_time::advance_ms(25);
+    driver.show();
+    uint8_t level = boards[0]->output(reg);
+    TEST_ASSERT_GREATER_OR_EQUAL(previous, level);
+    previous = level;
+    if (ms == 800) {
+      TEST_ASSERT_UINT32_WITHIN(8, 100, level);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT8(200, previous);
+  TEST_ASSERT_EQUAL_UINT32(0, bus->stats().transactions);
+
+  // Back to PWM control at the same level
+  driver.set_led_mode(9, 2, IS31FL3737_LED_MODE_PWM);
+  TEST_ASSERT_EQUAL_UINT8(200, boards[0]->output(reg));
+  // Other LEDs never breathed
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->abm(is31fl3737_pwm_register(10, 2)));
+}
+
+void test_breath_pulse_loops_then_stops_off() {
+  IS31FL3737Driver driver;
+  driver.begin(0x50, bus);
+  driver.set_pixel(1, 2, 255);
+  driver.show();
+
+  // 420 ms up, 420 ms down, 3 times
+  IS31FL3737Breath pulse = IS31FL3737Breath::pulse(420, 0, 420, 0, 3);
+  TEST_ASSERT_EQUAL_UINT32(840, pulse.period_ms());
+  driver.set_breath(2, pulse);
+  driver.set_led_mode(1, 2, 2);
+  driver.start_breath();
+  uint8_t reg = is31fl3737_pwm_register(1, 2);
+
+  host_time::advance_ms(420);
+  TEST_ASSERT_EQUAL_UINT8(255, boards[0]->output(reg));
+  host_time::advance_ms(420 + 210);
+  TEST_ASSERT_UINT32_WITHIN(2, 127, boards[0]->output(reg));
+  host_time::advance_ms(3 * 840);
+  TEST_ASSERT_EQUAL_UINT8(0, boards[0]->output(reg));
+}
+
+void test_led_mode_writes_only_on_change() {
+  IS31FL3737Driver driver;
+  driver.begin(0x50, bus);
+  bus->reset_stats();
+
+  driver.set_led_mode(4, 4, 3);
+  uint32_t first = bus->stats().transactions;
+  driver.set_led_mode(4, 4, 3);
+  TEST_ASSERT_EQUAL_UINT32(first, bus->stats().transactions);
+  TEST_ASSERT_EQUAL_UINT8(3, driver.get_led_mode(4, 4));
+
+  // Reset puts every LED back in PWM mode
+  driver.reset();
+  TEST_ASSERT_EQUAL_UINT8(IS31FL3737_LED_MODE_PWM, driver.get_led_mode(4, 4));
+  TEST_ASSERT_FALSE(driver.set_led_mode(4, 4, 4));
+  TEST_ASSERT_FALSE(driver.set_breath(0, IS31FL3737Breath()));
+}
+
+// ============================================================================
+// RetroTextDisplay on three modelled boards
+// ============================================================================
+
+void test_display_text_reaches_chips() {
+  TestDisplay display;
+  display.set_i2c_bus(bus);
+  display.set_board_addresses(BOARD_ADDRESSES[0], BOARD_ADDRESSES[1], BOARD_ADDRESSES[2]);
+  display.setup();
+  display.set_shimmer_mode(false);
+  display.set_text("RETRO 88.7FM");
+  run_display_until_complete(display);
+
+  assert_chips_match_display(display);
+  for (auto *board : boards) {
+    TEST_ASSERT_EQUAL_UINT32(0, board->locked_command_writes());
+    TEST_ASSERT_EQUAL_UINT32(0, board->dropped_writes());
+  }
+}
+
+void test_display_bus_cost_per_frame() {
+  TestDisplay display;
+  display.set_i2c_bus(bus);
+  display.set_board_addresses(BOARD_ADDRESSES[0], BOARD_ADDRESSES[1], BOARD_ADDRESSES[2]);
+  display.setup();
+  display.set_shimmer_mode(false);
+  display.set_smooth_scroll(true);
+  run_display_until_complete(display);
+
+  // Text change: most of the image differs
+  bus->reset_stats();
+  display.set_text("THE QUICK BROWN FOX JUMPS");
+  run_display_until_complete(display);
+  BusStats text_frame = bus->stats();
+  assert_chips_match_display(display);
+
+  // One smooth-scroll step once the start delay has passed
+  bus->reset_stats();
+  host_time::advance_ms(1000);
+  display.loop();
+  run_display_until_complete(display);
+  BusStats scroll_frame = bus->stats();
+  assert_chips_match_display(display);
+
+  // A whole-image push of three boards is at least 3 × 192 data bytes
+  TEST_ASSERT_LESS_THAN(3 * IS31FL3737_PWM_REGISTER_SIZE, text_frame.bytes);
+  TEST_ASSERT_GREATER_THAN(0, scroll_frame.bytes);
+
+  const BusStats *frames[] = {&text_frame, &scroll_frame};
+  const char *names[] = {"text change", "scroll step"};
+  for (int i = 0; i < 2; i++) {
+    char message[160];
+    snprintf(message, sizeof(message),
+             "%s: %u transactions, %llu bytes, bus time %.0f us @100kHz / %.0f us @400kHz / %.0f us @1MHz", names[i],
+             (unsigned) frames[i]->transactions, (unsigned long long) frames[i]->bytes,
+             frames[i]->time_us(I2C_STANDARD_MODE_HZ), frames[i]->time_us(I2C_FAST_MODE_HZ),
+             frames[i]->time_us(I2C_FAST_MODE_PLUS_HZ));
+    TEST_MESSAGE(message);
+  }
+}
+
+// ============================================================================
+// TCA8418 model
+// ============================================================================
+
+void test_tca8418_fifo_pops_in_order() {
+  keypad_chip->press(0, 1);
+  keypad_chip->release(0, 1);
+  keypad_chip->press(3, 3);
+
+  TEST_ASSERT_EQUAL_UINT8(3, read_reg(KEYPAD_ADDRESS, 0x03) & 0x0F);
+  TEST_ASSERT_EQUAL_HEX8(0x82, read_reg(KEYPAD_ADDRESS, 0x04));
+  TEST_ASSERT_EQUAL_HEX8(0x02, read_reg(KEYPAD_ADDRESS, 0x04));
+  TEST_ASSERT_EQUAL_HEX8(0xA2, read_reg(KEYPAD_ADDRESS, 0x04));
+  TEST_ASSERT_EQUAL_HEX8(0x00, read_reg(KEYPAD_ADDRESS, 0x04));
+  TEST_ASSERT_EQUAL_UINT8(0, read_reg(KEYPAD_ADDRESS, 0x03) & 0x0F);
+}
+
+void test_tca8418_burst_read_pops_without_auto_increment() {
+  for (uint8_t col = 0; col < 4; col++) {
+    keypad_chip->press(1, col);
+  }
+  uint8_t reg = 0x04;
+  uint8_t events[4] = {};
+  bus->write_readv(KEYPAD_ADDRESS, &reg, 1, events, 4);
+
+  TEST_ASSERT_EQUAL_HEX8(0x8B, events[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x8E, events[3]);
+  TEST_ASSERT_EQUAL_UINT8(0, keypad_chip->fifo_count());
+}
+
+void test_tca8418_overflow_drops_or_pushes_out() {
+  for (uint8_t i = 0; i < 12; i++) {
+    keypad_chip->press(0, i % 10);
+  }
+  TEST_ASSERT_EQUAL_UINT8(10, keypad_chip->fifo_count());
+  TEST_ASSERT_EQUAL_UINT32(2, keypad_chip->events_lost());
+  TEST_ASSERT_EQUAL_HEX8(0x08, keypad_chip->int_stat() & 0x08);
+  // Without OVR_FLOW_M the newest events are the ones lost
+  TEST_ASSERT_EQUAL_HEX8(0x81, read_reg(KEYPAD_ADDRESS, 0x04));
+
+  keypad_chip->reset();
+  write_reg(KEYPAD_ADDRESS, 0x01, 0x20);  // OVR_FLOW_M
+  for (uint8_t i = 0; i < 12; i++) {
+    keypad_chip->press(0, i % 10);
+  }
+  TEST_ASSERT_EQUAL_HEX8(0x83, read_reg(KEYPAD_ADDRESS, 0x04));
+}
+
+void test_tca8418_interrupt_status_clears_when_drained() {
+  write_reg(KEYPAD_ADDRESS, 0x01, 0x01);  // KE_IEN
+  TEST_ASSERT_FALSE(keypad_chip->int_asserted());
+
+  keypad_chip->press(2, 2);
+  keypad_chip->release(2, 2);
+  TEST_ASSERT_TRUE(keypad_chip->int_asserted());
+
+  // K_INT re-asserts while events are still queued
+  read_reg(KEYPAD_ADDRESS, 0x04);
+  write_reg(KEYPAD_ADDRESS, 0x02, 0x01);
+  TEST_ASSERT_TRUE(keypad_chip->int_asserted());
+
+  read_reg(KEYPAD_ADDRESS, 0x04);
+  write_reg(KEYPAD_ADDRESS, 0x02, 0x01);
+  TEST_ASSERT_FALSE(keypad_chip->int_asserted());
+}
+
+// ============================================================================
+// TCA8418Component on the model
+// ============================================================================
+
+void test_keypad_setup_configures_matrix() {
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.set_matrix_size(4, 10);
+  keypad.setup();
+
+  TEST_ASSERT_FALSE(keypad.is_failed());
+  TEST_ASSERT_EQUAL_HEX8(0x0F, keypad_chip->reg(0x1D));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, keypad_chip->reg(0x1E));
+  TEST_ASSERT_EQUAL_HEX8(0x03, keypad_chip->reg(0x1F));
+  TEST_ASSERT_EQUAL_HEX8(0x01, keypad_chip->reg(0x01));
+}
+
+void test_keypad_setup_fails_without_chip() {
+  bus->detach(KEYPAD_ADDRESS);
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.setup();
+  TEST_ASSERT_TRUE(keypad.is_failed());
+}
+
+void test_keypad_loop_delivers_fifo_events() {
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.setup();
+
+  keypad_chip->press(2, 5);
+  keypad_chip->release(2, 5);
+  keypad_chip->press(0, 9);
+  bus->reset_stats();
+  keypad.loop();
+
+  TEST_ASSERT_EQUAL_size_t(3, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(2, keypad.events[0].row);
+  TEST_ASSERT_EQUAL_UINT8(5, keypad.events[0].col);
+  TEST_ASSERT_TRUE(keypad.events[0].press);
+  TEST_ASSERT_FALSE(keypad.events[1].press);
+  TEST_ASSERT_EQUAL_UINT8(9, keypad.events[2].col);
+  TEST_ASSERT_EQUAL_UINT8(0, keypad_chip->fifo_count());
+
+  // Count read plus one burst read of the events, each a single write_readv
+  TEST_ASSERT_EQUAL_UINT32(2, bus->stats().transactions);
+
+  // An idle poll still costs the count read
+  bus->reset_stats();
+  keypad.loop();
+  TEST_ASSERT_EQUAL_UINT32(1, bus->stats().transactions);
+}
+
+void test_keypad_spreads_batch_timestamps_since_fifo_empty() {
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.setup();
+  tca8418_keypad::KeyEventQueue key_events;
+  keypad.add_event_queue(&key_events);
+
+  // The idle poll sees the FIFO empty; three detents land before the next one
+  keypad.loop();
+  uint32_t empty_us = micros();
+  host_time::advance_ms(9);
+  for (uint8_t col = 0; col < 3; col++) {
+    keypad_chip->press(1, col);
+  }
+  keypad.loop();
+
+  tca8418_keypad::TimedKeyEvent events[3];
+  for (auto &event : events) {
+    TEST_ASSERT_TRUE(key_events.pop(&event));
+  }
+  // Newest at the drain time, the others spread back over the 9 ms window
+  TEST_ASSERT_EQUAL_UINT32(empty_us + 9000, events[2].timestamp_us);
+  TEST_ASSERT_EQUAL_UINT32(3000, events[1].timestamp_us - events[0].timestamp_us);
+  TEST_ASSERT_EQUAL_UINT32(3000, events[2].timestamp_us - events[1].timestamp_us);
+
+  // A single event right after is stamped with its own drain, not spread
+  host_time::advance_ms(2);
+  keypad_chip->release(1, 0);
+  keypad.loop();
+  tca8418_keypad::TimedKeyEvent release;
+  TEST_ASSERT_TRUE(key_events.pop(&release));
+  TEST_ASSERT_EQUAL_UINT32(events[2].timestamp_us + 2000, release.timestamp_us);
+}
+
+void test_keypad_key_sensors_follow_their_keys() {
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  binary_sensor::BinarySensor memory, preset, replaced;
+  keypad.register_key_sensor(3, 5, &memory);
+  keypad.register_key_sensor(7, 9, &replaced);
+  keypad.register_key_sensor(7, 9, &preset);  // Same key: replaces the first
+  keypad.setup();
+
+  keypad_chip->press(3, 5);
+  keypad_chip->press(7, 9);
+  keypad_chip->press(0, 0);  // No sensor
+  keypad_chip->release(3, 5);
+  keypad.loop();
+
+  TEST_ASSERT_EQUAL_size_t(4, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT32(2, memory.publishes());
+  TEST_ASSERT_FALSE(memory.state);
+  TEST_ASSERT_EQUAL_UINT32(1, preset.publishes());
+  TEST_ASSERT_TRUE(preset.state);
+  TEST_ASSERT_EQUAL_UINT32(0, replaced.publishes());
+}
+
+void test_keypad_per_event_drain() {
+  TestKeypad keypad;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.set_burst_drain(false);
+  keypad.setup();
+
+  keypad_chip->press(2, 5);
+  keypad_chip->release(2, 5);
+  keypad_chip->press(0, 9);
+  bus->reset_stats();
+  keypad.loop();
+
+  TEST_ASSERT_EQUAL_size_t(3, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(9, keypad.events[2].col);
+  // Count read plus one register read per event
+  TEST_ASSERT_EQUAL_UINT32(4, bus->stats().transactions);
+}
+
+void test_keypad_burst_drains_full_fifo_and_counts_overflow() {
+  TestKeypad keypad;
+  sensor::Sensor overflows;
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.set_fifo_overflow_sensor(&overflows);
+  keypad.setup();
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 0.0, overflows.state);
+
+  // A fast encoder spin: 12 events into the 10-deep FIFO
+  for (uint8_t i = 0; i < 12; i++) {
+    keypad_chip->press(3, i % 10);
+  }
+  TEST_ASSERT_EQUAL_UINT32(2, keypad_chip->events_lost());
+  bus->reset_stats();
+  keypad.loop();
+
+  TEST_ASSERT_EQUAL_size_t(TCA8418_MODEL_FIFO_SIZE, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(0, keypad.events[0].col);
+  TEST_ASSERT_EQUAL_UINT8(9, keypad.events[9].col);
+  TEST_ASSERT_EQUAL_UINT32(1, keypad.get_fifo_overflows());
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 1.0, overflows.state);
+  TEST_ASSERT_EQUAL_HEX8(0x00, keypad_chip->int_stat() & 0x08);
+  // Count read, burst read, INT_STAT read and overflow clear
+  TEST_ASSERT_EQUAL_UINT32(4, bus->stats().transactions);
+
+  // Full but not overflowed: INT_STAT is checked, nothing counted
+  for (uint8_t i = 0; i < TCA8418_MODEL_FIFO_SIZE; i++) {
+    keypad_chip->release(3, i);
+  }
+  keypad.loop();
+  TEST_ASSERT_EQUAL_UINT32(1, keypad.get_fifo_overflows());
+  TEST_ASSERT_EQUAL_UINT32(2, keypad.get_drains());
+  TEST_ASSERT_EQUAL_UINT32(20, keypad.get_events_drained());
+}
+
+// Keypad in interrupt mode with the model's /INT wired to a pin
+void setup_interrupt_keypad(TestKeypad &keypad, SimulatedPin &int_pin) {
+  keypad_chip->on_int_change([&int_pin](bool asserted) { int_pin.set_level(!asserted); });
+  keypad.set_i2c_bus(bus);
+  keypad.set_i2c_address(KEYPAD_ADDRESS);
+  keypad.set_interrupt_pin(&int_pin);
+  keypad.setup();
+}
+
+void test_keypad_interrupt_mode_idle_loops_skip_bus() {
+  TestKeypad keypad;
+  SimulatedPin int_pin(27);
+  setup_interrupt_keypad(keypad, int_pin);
+
+  TEST_ASSERT_TRUE(int_pin.has_interrupt());
+  TEST_ASSERT_EQUAL(gpio::INTERRUPT_FALLING_EDGE, int_pin.interrupt_type());
+  // INT_CFG set so /INT re-pulses when cleared with events pending
+  TEST_ASSERT_EQUAL_HEX8(0x11, keypad_chip->reg(0x01));
+
+  bus->reset_stats();
+  for (int i = 0; i < 500; i++) {
+    host_time::advance_us(100);
+    keypad.loop();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bus->stats().transactions);
+  TEST_ASSERT_EQUAL_UINT32(0, keypad.get_event_reads());
+}
+
+void test_keypad_interrupt_delivers_events_and_clears_int_stat() {
+  TestKeypad keypad;
+  SimulatedPin int_pin(27);
+  setup_interrupt_keypad(keypad, int_pin);
+
+  keypad_chip->press(1, 4);
+  keypad_chip->release(1, 4);
+  TEST_ASSERT_FALSE(int_pin.level());
+  TEST_ASSERT_EQUAL_UINT32(1, keypad.get_interrupt_count());
+
+  bus->reset_stats();
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(2, keypad.events.size());
+  TEST_ASSERT_TRUE(keypad.events[0].press);
+  TEST_ASSERT_EQUAL_UINT8(4, keypad.events[1].col);
+  // Count read, burst event read, INT_STAT clear
+  TEST_ASSERT_EQUAL_UINT32(3, bus->stats().transactions);
+  TEST_ASSERT_EQUAL_HEX8(0x00, keypad_chip->int_stat());
+  TEST_ASSERT_TRUE(int_pin.level());
+
+  bus->reset_stats();
+  keypad.loop();
+  TEST_ASSERT_EQUAL_UINT32(0, bus->stats().transactions);
+  TEST_ASSERT_EQUAL_UINT32(1, keypad.get_event_reads());
+}
+
+// Chip that queues one more key right after the first event burst read
+class RacingKeypadChip : public TCA8418Model {
+ public:
+  bool on_read(uint8_t *data, size_t len) override {
+    bool events = this->pointer_ == 0x04;
+    bool ok = TCA8418Model::on_read(data, len);
+    if (events && len > 0 && data[0] != 0 && !this->raced_) {
+      this->raced_ = true;
+      this->press(0, 1);
+    }
+    return ok;
+  }
+
+ protected:
+  bool raced_{false};
+};
+
+void test_keypad_interrupt_level_catches_events_without_new_edge() {
+  bus->detach(KEYPAD_ADDRESS);
+  delete keypad_chip;
+  keypad_chip = new RacingKeypadChip();
+  bus->attach(KEYPAD_ADDRESS, keypad_chip);
+
+  TestKeypad keypad;
+  SimulatedPin int_pin(27);
+  setup_interrupt_keypad(keypad, int_pin);
+
+  // A key lands in the FIFO while the first one is being drained: clearing
+  // INT_STAT leaves K_INT set, /INT never goes high and no edge fires
+  keypad_chip->press(0, 0);
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(1, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(1, keypad_chip->fifo_count());
+  TEST_ASSERT_FALSE(int_pin.level());
+  TEST_ASSERT_EQUAL_UINT32(1, int_pin.interrupts());
+
+  // The level check picks it up on the next loop
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(2, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(1, keypad.events[1].col);
+  TEST_ASSERT_TRUE(int_pin.level());
+  TEST_ASSERT_EQUAL_UINT32(2, keypad.get_event_reads());
+}
+
+void test_keypad_interrupt_safety_poll() {
+  TestKeypad keypad;
+  SimulatedPin int_pin(27);
+  setup_interrupt_keypad(keypad, int_pin);
+
+  // Lose the edge: queue an event with the pin detached from the model
+  keypad_chip->on_int_change(nullptr);
+  keypad_chip->press(3, 9);
+  TEST_ASSERT_TRUE(int_pin.level());
+
+  host_time::advance_ms(tca8418_keypad::TCA8418_SAFETY_POLL_MS - 1);
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(0, keypad.events.size());
+
+  host_time::advance_ms(1);
+  keypad.loop();
+  TEST_ASSERT_EQUAL_size_t(1, keypad.events.size());
+  TEST_ASSERT_EQUAL_UINT8(9, keypad.events[0].col);
+  TEST_ASSERT_EQUAL_UINT32(1, keypad.get_safety_polls());
+  TEST_ASSERT_EQUAL_UINT32(0, keypad.get_event_reads());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_bus_nacks_missing_device);
+  RUN_TEST(test_bus_counts_wire_time);
+  RUN_TEST(test_bus_advances_host_clock);
+
+  RUN_TEST(test_is31fl3737_page_select_requires_unlock);
+  RUN_TEST(test_is31fl3737_burst_write_auto_increments);
+  RUN_TEST(test_is31fl3737_drops_read_only_writes);
+  RUN_TEST(test_is31fl3737_reset_register_restores_defaults);
+  RUN_TEST(test_is31fl3737_output_needs_led_enable_and_normal_operation);
+
+  RUN_TEST(test_driver_begin_configures_chip);
+  RUN_TEST(test_driver_frames_match_chip_registers);
+
+  RUN_TEST(test_abm_timing_codes);
+  RUN_TEST(test_breath_fade_in_runs_without_bus_traffic);
+  RUN_TEST(test_breath_pulse_loops_then_stops_off);
+  RUN_TEST(test_led_mode_writes_only_on_change);
+
+  RUN_TEST(test_display_text_reaches_chips);
+  RUN_TEST(test_display_bus_cost_per_frame);
+
+  RUN_TEST(test_tca8418_fifo_pops_in_order);
+  RUN_TEST(test_tca8418_burst_read_pops_without_auto_increment);
+  RUN_TEST(test_tca8418_overflow_drops_or_pushes_out);
+  RUN_TEST(test_tca8418_interrupt_status_clears_when_drained);
+
+  RUN_TEST(test_keypad_setup_configures_matrix);
+  RUN_TEST(test_keypad_setup_fails_without_chip);
+  RUN_TEST(test_keypad_loop_delivers_fifo_events);
+  RUN_TEST(test_keypad_spreads_batch_timestamps_since_fifo_empty);
+  RUN_TEST(test_keypad_key_sensors_follow_their_keys);
+  RUN_TEST(test_keypad_per_event_drain);
+  RUN_TEST(test_keypad_burst_drains_full_fifo_and_counts_overflow);
+  RUN_TEST(test_keypad_interrupt_mode_idle_loops_skip_bus);
+  RUN_TEST(test_keypad_interrupt_delivers_events_and_clears_int_stat);
+  RUN_TEST(test_keypad_interrupt_level_catches_events_without_new_edge);
+  RUN_TEST(test_keypad_interrupt_safety_poll);
+
+  return UNITY_END();
+}
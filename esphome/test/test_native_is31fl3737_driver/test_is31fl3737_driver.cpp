@@ -0,0 +1,326 @@
+/**
+ * @file test_is31fl3737_driver.cpp
+ * @brief Unit tests for IS31FL3737Driver dirty-region pushes
+ *
+ * A recording bus captures every write so the tests can check which PWM
+ * registers show() sends after the first full frame.
+ */
+
+#include <unity.h>
+#include <cstring>
+#include <vector>
+#include "esphome/components/retrotext_display/is31fl3737_driver.h"
+
+using namespace esphome;
+using namespace esphome::retrotext_display;
+
+namespace {
+
+// Records every write and the page selected when it was sent; reads return zero
+class RecordingBus : public i2c::I2CBus {
+ public:
+  std::vector<std::vector<uint8_t>> writes;
+  std::vector<uint8_t> write_pages;
+  uint8_t page{0xFF};
+  bool fail_writes{false};
+
+  i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                              size_t read_count) override {
+    memset(read_buffer, 0, read_count);
+    if (write_count == 0) {
+      return i2c::ERROR_OK;
+    }
+    std::vector<uint8_t> bytes(write_buffer, write_buffer + write_count);
+    this->writes.push_back(bytes);
+    this->write_pages.push_back(this->page);
+    if (this->fail_writes) {
+      return i2c::ERROR_NOT_ACKNOWLEDGED;
+    }
+    if (bytes[0] == 0xFD) {
+      this->page = bytes[1];
+    }
+    return i2c::ERROR_OK;
+  }
+
+  void clear() {
+    this->writes.clear();
+    this->write_pages.clear();
+  }
+
+  // Writes issued while the PWM page is selected (page unlock/select excluded)
+  std::vector<std::vector<uint8_t>> pwm_writes() const {
+    std::vector<std::vector<uint8_t>> result;
+    for (size_t i = 0; i < this->writes.size(); i++) {
+      const auto &w = this->writes[i];
+      if (w[0] != 0xFE && w[0] != 0xFD && this->write_pages[i] == 0x01) {
+        result.push_back(w);
+      }
+    }
+    return result;
+  }
+
+  // Page select commands (0xFD writes)
+  size_t page_selects() const {
+    size_t count = 0;
+    for (const auto &w : this->writes) {
+      if (w[0] == 0xFD) {
+        count++;
+      }
+    }
+    return count;
+  }
+};
+
+RecordingBus *bus;
+IS31FL3737Driver *driver;
+
+}  // namespace
+
+void setUp(void) {
+  bus = new RecordingBus();
+  driver = new IS31FL3737Driver();
+  driver->begin(0x50, bus);
+  driver->show();  // First frame is always a full push
+  bus->clear();
+  driver->reset_stats();
+}
+
+void tearDown(void) {
+  delete driver;
+  delete bus;
+}
+
+void test_first_show_pushes_full_image() {
+  IS31FL3737Driver fresh;
+  RecordingBus fresh_bus;
+  fresh.begin(0x5A, &fresh_bus);
+  fresh_bus.clear();
+
+  fresh.show();
+
+  auto pwm = fresh_bus.pwm_writes();
+  TEST_ASSERT_EQUAL(3, pwm.size());
+  TEST_ASSERT_EQUAL(0x00, pwm[0][0]);
+  TEST_ASSERT_EQUAL(0x40, pwm[1][0]);
+  TEST_ASSERT_EQUAL(0x80, pwm[2][0]);
+  TEST_ASSERT_EQUAL(192, fresh.get_stats().bytes_written);
+}
+
+void test_unchanged_frame_sends_nothing() {
+  driver->show();
+
+  TEST_ASSERT_EQUAL(0, bus->writes.size());  // Not even a page select
+  TEST_ASSERT_EQUAL(1, driver->get_stats().frames_unchanged);
+  TEST_ASSERT_EQUAL(192, driver->get_stats().bytes_saved());
+}
+
+void test_single_pixel_sends_one_register() {
+  driver->set_pixel(7, 2, 200);  // CS8 is remapped to register column 9
+  driver->show();
+
+  auto pwm = bus->pwm_writes();
+  TEST_ASSERT_EQUAL(1, pwm.size());
+  TEST_ASSERT_EQUAL(2, pwm[0].size());
+  TEST_ASSERT_EQUAL(2 * 16 + 9, pwm[0][0]);
+  TEST_ASSERT_EQUAL(200, pwm[0][1]);
+  TEST_ASSERT_EQUAL(1, driver->get_stats().transactions);
+  TEST_ASSERT_EQUAL(2, driver->get_stats().transactions_saved());
+}
+
+void test_nearby_changes_are_merged() {
+  driver->set_pixel(0, 0, 10);  // Register 0x00
+  driver->set_pixel(5, 0, 20);  // Register 0x05 - gap of 4
+  driver->show();
+
+  auto pwm = bus->pwm_writes();
+  TEST_ASSERT_EQUAL(1, pwm.size());
+  TEST_ASSERT_EQUAL(0x00, pwm[0][0]);
+  TEST_ASSERT_EQUAL(6 + 1, pwm[0].size());
+  TEST_ASSERT_EQUAL(10, pwm[0][1]);
+  TEST_ASSERT_EQUAL(20, pwm[0][6]);
+}
+
+void test_distant_changes_are_separate_writes() {
+  driver->set_pixel(0, 0, 10);   // Register 0x00
+  driver->set_pixel(0, 11, 20);  // Register 0xB0
+  driver->show();
+
+  auto pwm = bus->pwm_writes();
+  TEST_ASSERT_EQUAL(2, pwm.size());
+  TEST_ASSERT_EQUAL(0x00, pwm[0][0]);
+  TEST_ASSERT_EQUAL(0xB0, pwm[1][0]);
+  TEST_ASSERT_EQUAL(2, driver->get_stats().bytes_written);
+}
+
+void test_long_runs_are_chunked() {
+  for (uint8_t y = 0; y < 12; y++) {
+    for (uint8_t x = 0; x < 12; x++) {
+      driver->set_pixel(x, y, 1);
+    }
+  }
+  driver->show();
+
+  auto pwm = bus->pwm_writes();
+  TEST_ASSERT_EQUAL(3, pwm.size());
+  for (const auto &w : pwm) {
+    TEST_ASSERT_LESS_OR_EQUAL(65, w.size());
+  }
+}
+
+void test_failed_write_forces_full_push() {
+  driver->set_pixel(3, 3, 50);
+  bus->fail_writes = true;
+  driver->show();
+  bus->fail_writes = false;
+  bus->clear();
+
+  driver->show();
+
+  TEST_ASSERT_EQUAL(3, bus->pwm_writes().size());
+}
+
+void test_incremental_push_one_write_per_step() {
+  driver->set_pixel(0, 0, 10);
+  driver->set_pixel(0, 11, 20);
+  driver->start_show();
+  TEST_ASSERT_TRUE(driver->is_show_pending());
+  TEST_ASSERT_EQUAL(0, bus->pwm_writes().size());
+
+  TEST_ASSERT_FALSE(driver->show_step());
+  TEST_ASSERT_EQUAL(1, bus->pwm_writes().size());
+  TEST_ASSERT_TRUE(driver->show_step());  // Second run completes the frame
+  TEST_ASSERT_EQUAL(2, bus->pwm_writes().size());
+  TEST_ASSERT_FALSE(driver->is_show_pending());
+
+  // Nothing left: a new frame completes without writes
+  driver->start_show();
+  TEST_ASSERT_TRUE(driver->show_step());
+  TEST_ASSERT_EQUAL(2, bus->pwm_writes().size());
+  TEST_ASSERT_EQUAL(1, driver->get_stats().frames_unchanged);
+}
+
+void test_incremental_full_push_in_chunks() {
+  driver->reset();  // Invalidates the shadow
+  bus->clear();
+  driver->start_show();
+  int steps = 0;
+  while (!driver->show_step()) {
+    steps++;
+  }
+  steps++;
+  TEST_ASSERT_EQUAL(3, steps);
+  TEST_ASSERT_EQUAL(3, bus->pwm_writes().size());
+}
+
+void test_show_skips_page_select_when_on_pwm_page() {
+  driver->set_pixel(3, 3, 50);
+  driver->show();
+  driver->set_pixel(4, 4, 60);
+  driver->show();
+  TEST_ASSERT_EQUAL(0, bus->page_selects());
+  TEST_ASSERT_EQUAL(2, bus->writes.size());
+  TEST_ASSERT_EQUAL(2, driver->get_stats().page_selects_skipped);
+}
+
+void test_global_current_switches_page_once() {
+  driver->set_global_current(40);
+  // Unlock + function page + current register, no switch back
+  TEST_ASSERT_EQUAL(3, bus->writes.size());
+  TEST_ASSERT_EQUAL(1, bus->page_selects());
+
+  driver->set_global_current(50);
+  TEST_ASSERT_EQUAL(4, bus->writes.size());  // Already on the function page
+
+  driver->set_pixel(0, 0, 1);
+  driver->show();  // Back to PWM only because there is something to send
+  TEST_ASSERT_EQUAL(2, bus->page_selects());
+  TEST_ASSERT_EQUAL(1, bus->pwm_writes().size());
+}
+
+void test_i2c_error_forgets_page() {
+  driver->set_pixel(0, 0, 1);
+  bus->fail_writes = true;
+  driver->show();
+  bus->fail_writes = false;
+  bus->clear();
+
+  driver->show();
+  TEST_ASSERT_EQUAL(1, bus->page_selects());  // Page reselected before the retry
+  TEST_ASSERT_EQUAL(3, bus->pwm_writes().size());
+}
+
+void test_reset_forgets_page() {
+  driver->reset();
+  driver->clear();
+  bus->clear();
+  driver->show();
+  TEST_ASSERT_EQUAL(1, bus->page_selects());
+  TEST_ASSERT_EQUAL(3, bus->pwm_writes().size());
+}
+
+void test_bus_write_counter() {
+  driver->set_global_current(10);
+  driver->set_pixel(0, 0, 1);
+  driver->set_pixel(0, 11, 1);
+  driver->show();
+  TEST_ASSERT_EQUAL(bus->writes.size(), driver->get_stats().bus_writes);
+  TEST_ASSERT_EQUAL(2, driver->get_stats().page_selects);
+}
+
+void test_requests_coalesce_into_one_flush() {
+  // Three helpers each change an LED and ask for a push in the same loop pass
+  driver->set_pixel(3, 3, 255);
+  driver->request_show();
+  driver->set_pixel(7, 0, 255);
+  driver->request_show();
+  driver->set_pixel(5, 3, 64);
+  driver->request_show();
+  TEST_ASSERT_EQUAL(0, bus->writes.size());
+  TEST_ASSERT_TRUE(driver->is_flush_pending());
+
+  TEST_ASSERT_TRUE(driver->flush());
+  TEST_ASSERT_EQUAL(1, driver->get_stats().frames);
+  TEST_ASSERT_EQUAL(3, driver->get_stats().show_requests);
+  TEST_ASSERT_EQUAL(2, driver->get_stats().flushes_avoided());
+  // Only the changed registers: 0x33/0x35 merged, 0x09 alone
+  TEST_ASSERT_EQUAL(2, bus->pwm_writes().size());
+
+  // Nothing requested, nothing sent
+  bus->clear();
+  TEST_ASSERT_FALSE(driver->flush());
+  TEST_ASSERT_EQUAL(0, bus->writes.size());
+  TEST_ASSERT_EQUAL(1, driver->get_stats().flushes);
+}
+
+void test_flush_of_unchanged_image_sends_nothing() {
+  driver->set_pixel(1, 1, 50);
+  driver->set_pixel(1, 1, 0);  // Changed back before the flush
+  driver->request_show();
+  TEST_ASSERT_TRUE(driver->flush());
+  TEST_ASSERT_EQUAL(0, bus->writes.size());
+  TEST_ASSERT_EQUAL(1, driver->get_stats().frames_unchanged);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_first_show_pushes_full_image);
+  RUN_TEST(test_unchanged_frame_sends_nothing);
+  RUN_TEST(test_single_pixel_sends_one_register);
+  RUN_TEST(test_nearby_changes_are_merged);
+  RUN_TEST(test_distant_changes_are_separate_writes);
+  RUN_TEST(test_long_runs_are_chunked);
+  RUN_TEST(test_failed_write_forces_full_push);
+
+  RUN_TEST(test_incremental_push_one_write_per_step);
+  RUN_TEST(test_incremental_full_push_in_chunks);
+  RUN_TEST(test_show_skips_page_select_when_on_pwm_page);
+  RUN_TEST(test_global_current_switches_page_once);
+  RUN_TEST(test_i2c_error_forgets_page);
+  RUN_TEST(test_reset_forgets_page);
+  RUN_TEST(test_bus_write_counter);
+
+  RUN_TEST(test_requests_coalesce_into_one_flush);
+  RUN_TEST(test_flush_of_unchanged_image_sends_nothing);
+  return UNITY_END();
+}
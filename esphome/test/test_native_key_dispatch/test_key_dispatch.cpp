@@ -0,0 +1,71 @@
+/**
+ * @file test_key_dispatch.cpp
+ * @brief Unit tests for the generated key dispatch table
+ */
+
+#include <unity.h>
+#include "esphome/components/radio_controller/key_dispatch.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+// What the codegen emits for devices/radio.yaml: seven presets on row 3,
+// encoder button (2,1), memory button (3,5)
+constexpr uint8_t RADIO_KEY_MAP[KEY_DISPATCH_SIZE] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x61, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x12,
+    0x11, 0x10, 0x00, 0x50, 0x16, 0x15, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+constexpr KeyDispatch DISPATCH(RADIO_KEY_MAP);
+
+// Routing resolves at compile time
+static_assert(DISPATCH.lookup(2, 2) == KEY_ACTION_ENCODER_A, "encoder A");
+static_assert(key_action_arg(DISPATCH.lookup(3, 8)) == 4, "fifth preset");
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_presets_map_to_slots() {
+  const uint8_t columns[] = {3, 2, 1, 0, 8, 7, 6};
+  for (uint8_t slot = 0; slot < 7; slot++) {
+    uint8_t entry = DISPATCH.lookup(3, columns[slot]);
+    TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_PRESET, key_action_kind(entry));
+    TEST_ASSERT_EQUAL_UINT8(slot, key_action_arg(entry));
+  }
+}
+
+void test_controls_and_mode_selector() {
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_ENCODER_A, DISPATCH.lookup(2, 2));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_ENCODER_B, DISPATCH.lookup(2, 3));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_ENCODER_BUTTON, DISPATCH.lookup(2, 1));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_MEMORY, DISPATCH.lookup(3, 5));
+  for (uint8_t mode = 0; mode < 4; mode++) {
+    uint8_t entry = DISPATCH.lookup(0, 5 + mode);
+    TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_MODE, key_action_kind(entry));
+    TEST_ASSERT_EQUAL_UINT8(mode, key_action_arg(entry));
+  }
+}
+
+void test_unmapped_and_out_of_range_keys() {
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_NONE, DISPATCH.lookup(0, 0));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_NONE, DISPATCH.lookup(7, 9));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_NONE, DISPATCH.lookup(8, 0));
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_NONE, DISPATCH.lookup(0, 10));
+  // GPIO events decode to row/col 0xFF
+  TEST_ASSERT_EQUAL_UINT8(KEY_ACTION_NONE, DISPATCH.lookup(0xFF, 0xFF));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_presets_map_to_slots);
+  RUN_TEST(test_controls_and_mode_selector);
+  RUN_TEST(test_unmapped_and_out_of_range_keys);
+
+  return UNITY_END();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_key_event_queue.cpp
+ * @brief Unit tests for the timestamped key event ring buffer
+ */
+
+#include <unity.h>
+#include "esphome/components/tca8418_keypad/key_event_queue.h"
+
+using namespace esphome::tca8418_keypad;
+
+namespace {
+
+TimedKeyEvent make_event(uint32_t timestamp_us, uint8_t col, bool press = true) {
+  return TimedKeyEvent{timestamp_us, 1, col, press};
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_pops_in_push_order() {
+  KeyEventQueue queue;
+  TEST_ASSERT_TRUE(queue.empty());
+  TEST_ASSERT_TRUE(queue.push(make_event(100, 2, true)));
+  TEST_ASSERT_TRUE(queue.push(make_event(250, 2, false)));
+  TEST_ASSERT_EQUAL_UINT16(2, queue.size());
+
+  TimedKeyEvent event;
+  TEST_ASSERT_TRUE(queue.pop(&event));
+  TEST_ASSERT_EQUAL_UINT32(100, event.timestamp_us);
+  TEST_ASSERT_TRUE(event.press);
+  TEST_ASSERT_TRUE(queue.pop(&event));
+  TEST_ASSERT_EQUAL_UINT32(250, event.timestamp_us);
+  TEST_ASSERT_FALSE(event.press);
+  TEST_ASSERT_FALSE(queue.pop(&event));
+  TEST_ASSERT_TRUE(queue.empty());
+}
+
+void test_full_queue_drops_newest_and_counts() {
+  KeyEventQueue queue;
+  for (uint16_t i = 0; i < KEY_EVENT_QUEUE_SIZE + 3; i++) {
+    queue.push(make_event(i, i % 10));
+  }
+  TEST_ASSERT_EQUAL_UINT16(KEY_EVENT_QUEUE_SIZE, queue.size());
+  TEST_ASSERT_EQUAL_UINT32(KEY_EVENT_QUEUE_SIZE, queue.get_pushed());
+  TEST_ASSERT_EQUAL_UINT32(3, queue.get_dropped());
+  TEST_ASSERT_EQUAL_UINT16(KEY_EVENT_QUEUE_SIZE, queue.get_high_water());
+
+  // The oldest events survive; the consumer sees the overflow as a gap at the end
+  TimedKeyEvent event;
+  TEST_ASSERT_TRUE(queue.pop(&event));
+  TEST_ASSERT_EQUAL_UINT32(0, event.timestamp_us);
+
+  // Space frees up as the consumer catches up
+  TEST_ASSERT_TRUE(queue.push(make_event(999, 0)));
+  TEST_ASSERT_EQUAL_UINT32(3, queue.get_dropped());
+}
+
+void test_indices_wrap_around() {
+  KeyEventQueue queue;
+  TimedKeyEvent event;
+  // Free-running 16-bit indices wrap several times
+  for (uint32_t i = 0; i < 199998; i++) {
+    TEST_ASSERT_TRUE(queue.push(make_event(i, 0)));
+    if (i % 3 == 2) {
+      TEST_ASSERT_TRUE(queue.pop(&event));
+      TEST_ASSERT_TRUE(queue.pop(&event));
+      TEST_ASSERT_TRUE(queue.pop(&event));
+      TEST_ASSERT_EQUAL_UINT32(i, event.timestamp_us);
+    }
+  }
+  TEST_ASSERT_TRUE(queue.empty());
+  TEST_ASSERT_EQUAL_UINT16(3, queue.get_high_water());
+  TEST_ASSERT_EQUAL_UINT32(0, queue.get_dropped());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_pops_in_push_order);
+  RUN_TEST(test_full_queue_drops_newest_and_counts);
+  RUN_TEST(test_indices_wrap_around);
+
+  return UNITY_END();
+}
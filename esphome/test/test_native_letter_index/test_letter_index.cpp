@@ -0,0 +1,96 @@
+/**
+ * @file test_letter_index.cpp
+ * @brief Unit tests for the first-letter browse jump index
+ */
+
+#include <unity.h>
+#include <vector>
+#include "esphome/components/radio_controller/letter_index.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+// Radios by name, then playlists by name, as load_all_favorites.yaml sends them
+const std::vector<const char *> FAVORITES = {
+    "1LIVE",     "Bayern 3", "bbc radio 6", "\"Deutschlandfunk\"", "FIP",
+    "KEXP",      "kcrw",     "Zwei",        "Ambient Mix",         "Chill Beats",
+};
+
+LetterIndex build_index() {
+  LetterIndex index;
+  index.build(FAVORITES.size(), [](size_t i) { return FAVORITES[i]; });
+  return index;
+}
+
+}  // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_initials_skip_punctuation_and_fold_case() {
+  TEST_ASSERT_EQUAL_INT('D', name_initial("\"Deutschlandfunk\""));
+  TEST_ASSERT_EQUAL_INT('B', name_initial("bbc radio 6"));
+  TEST_ASSERT_EQUAL_INT('#', name_initial("1LIVE"));
+  TEST_ASSERT_EQUAL_INT(' ', name_initial("---"));
+  TEST_ASSERT_EQUAL_UINT8(0, letter_group('#'));
+  TEST_ASSERT_EQUAL_UINT8(0, letter_group(' '));
+  TEST_ASSERT_EQUAL_UINT8(26, letter_group('Z'));
+  TEST_ASSERT_EQUAL_INT('#', letter_group_initial(0));
+  TEST_ASSERT_EQUAL_INT('K', letter_group_initial(letter_group('K')));
+}
+
+void test_starts_of_each_letter() {
+  LetterIndex index = build_index();
+  // '#', B, D, F, K, Z in the radios, then A and C in the playlists
+  TEST_ASSERT_EQUAL_size_t(8, index.get_starts());
+  TEST_ASSERT_EQUAL_UINT8(8, index.get_groups());
+  TEST_ASSERT_EQUAL_UINT16(1, index.next(0));
+  TEST_ASSERT_EQUAL_UINT16(3, index.next(1));
+  TEST_ASSERT_EQUAL_UINT16(3, index.next(2));
+  TEST_ASSERT_EQUAL_UINT16(5, index.next(4));
+}
+
+void test_forward_jumps_run_on_into_the_playlists() {
+  LetterIndex index = build_index();
+  // From the radios' Z to the playlists' A, then C, then the end
+  TEST_ASSERT_EQUAL_UINT16(7, index.next(5));
+  TEST_ASSERT_EQUAL_UINT16(8, index.next(7));
+  TEST_ASSERT_EQUAL_UINT16(9, index.next(8));
+  TEST_ASSERT_EQUAL_UINT16(LETTER_NONE, index.next(9));
+}
+
+void test_backward_jumps_go_to_the_letter_start_then_the_one_before() {
+  LetterIndex index = build_index();
+  TEST_ASSERT_EQUAL_UINT16(5, index.previous(6));
+  TEST_ASSERT_EQUAL_UINT16(4, index.previous(5));
+  // From the playlists' A back into the radios' Z
+  TEST_ASSERT_EQUAL_UINT16(7, index.previous(8));
+  TEST_ASSERT_EQUAL_UINT16(0, index.previous(1));
+  TEST_ASSERT_EQUAL_UINT16(LETTER_NONE, index.previous(0));
+}
+
+void test_rebuild_replaces_the_previous_list() {
+  LetterIndex index = build_index();
+  std::vector<const char *> page = {"Radio Paradise", "SomaFM"};
+  index.build(page.size(), [&page](size_t i) { return page[i]; });
+  TEST_ASSERT_EQUAL_size_t(2, index.get_starts());
+  TEST_ASSERT_EQUAL_UINT16(1, index.next(0));
+  TEST_ASSERT_EQUAL_UINT16(LETTER_NONE, index.next(1));
+  TEST_ASSERT_EQUAL_UINT8(2, index.get_groups());
+  index.clear();
+  TEST_ASSERT_EQUAL_UINT8(0, index.get_groups());
+  TEST_ASSERT_EQUAL_UINT16(LETTER_NONE, index.next(0));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_initials_skip_punctuation_and_fold_case);
+  RUN_TEST(test_starts_of_each_letter);
+  RUN_TEST(test_forward_jumps_run_on_into_the_playlists);
+  RUN_TEST(test_backward_jumps_go_to_the_letter_start_then_the_one_before);
+  RUN_TEST(test_rebuild_replaces_the_previous_list);
+
+  return UNITY_END();
+}
@@ -0,0 +1,221 @@
+/**
+ * @file test_quadrature_decoder.cpp
+ * @brief Tests and host benchmark for the table-driven quadrature decoder
+ *
+ * The reference below is the previous if-chain decoder from
+ * RadioController::process_encoder_rotation_(). The benchmark replays key
+ * event traces through both.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "esphome/components/radio_controller/quadrature_decoder.h"
+
+using namespace esphome::radio_controller;
+
+namespace {
+
+// Encoder channel edge as the keypad queue delivers it
+struct Edge {
+  uint32_t timestamp_us;
+  bool is_a;
+  bool level;
+};
+
+// Previous decoder: Gray code comparison chain, 2 steps per detent
+struct ReferenceDecoder {
+  bool a{false};
+  bool b{false};
+  uint8_t last{0};
+  int8_t progress{0};
+
+  int8_t update_channel(bool is_a, bool level) {
+    (is_a ? a : b) = level;
+    uint8_t state = (a ? 0b10 : 0) | (b ? 0b01 : 0);
+    uint8_t old_state = last;
+    if (state == old_state) {
+      return 0;
+    }
+    last = state;
+    int8_t direction = 0;
+    if ((old_state == 0b00 && state == 0b01) || (old_state == 0b01 && state == 0b11) ||
+        (old_state == 0b11 && state == 0b10) || (old_state == 0b10 && state == 0b00)) {
+      direction = 1;
+    } else if ((old_state == 0b00 && state == 0b10) || (old_state == 0b10 && state == 0b11) ||
+               (old_state == 0b11 && state == 0b01) || (old_state == 0b01 && state == 0b00)) {
+      direction = -1;
+    } else {
+      progress = 0;
+      return 0;
+    }
+    progress += direction;
+    if (progress >= 2) {
+      progress = 0;
+      return 1;
+    }
+    if (progress <= -2) {
+      progress = 0;
+      return -1;
+    }
+    return 0;
+  }
+};
+
+// Edges for `detents` clockwise (or counter-clockwise) detents of two
+// steps, interval_us apart, continuing from position `step` in the cycle
+void turn(std::vector<Edge> &trace, uint32_t &now, int &step, int detents, uint32_t interval_us, bool clockwise) {
+  // Clockwise: 00 -> 01 -> 11 -> 10 -> 00
+  const uint8_t cycle[] = {0b00, 0b01, 0b11, 0b10};
+  for (int i = 0; i < detents * 2; i++) {
+    uint8_t from = cycle[step & 3];
+    step += clockwise ? 1 : -1;
+    uint8_t to = cycle[step & 3];
+    now += interval_us / 2;
+    bool is_a = ((from ^ to) & 0b10) != 0;
+    trace.push_back({now, is_a, (to & (is_a ? 0b10 : 0b01)) != 0});
+  }
+}
+
+// A browsing session: slow clicks, a fast spin, a reversal and a contact
+// bounce (the same level reported twice)
+std::vector<Edge> browse_trace() {
+  std::vector<Edge> trace;
+  uint32_t now = 0;
+  int step = 0;
+  turn(trace, now, step, 6, 250000, true);
+  turn(trace, now, step, 40, 12000, true);
+  turn(trace, now, step, 10, 60000, false);
+  trace.push_back({now + 300, trace.back().is_a, trace.back().level});
+  turn(trace, now, step, 4, 180000, false);
+  return trace;
+}
+
+}  // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_table_follows_gray_code() {
+  const uint8_t clockwise[] = {0b00, 0b01, 0b11, 0b10};
+  for (int i = 0; i < 4; i++) {
+    uint8_t from = clockwise[i];
+    uint8_t to = clockwise[(i + 1) % 4];
+    TEST_ASSERT_EQUAL_INT(1, QUADRATURE_TRANSITIONS[(from << 2) | to]);
+    TEST_ASSERT_EQUAL_INT(-1, QUADRATURE_TRANSITIONS[(to << 2) | from]);
+    TEST_ASSERT_EQUAL_INT(0, QUADRATURE_TRANSITIONS[(from << 2) | from]);
+    // Opposite corner: both channels changed
+    TEST_ASSERT_EQUAL_INT(QUADRATURE_ILLEGAL, QUADRATURE_TRANSITIONS[(from << 2) | (from ^ 0b11)]);
+  }
+}
+
+void test_steps_per_detent() {
+  QuadratureDecoder half(2);
+  QuadratureDecoder full(4);
+  const bool a[] = {false, true, true, false};
+  const bool b[] = {true, true, false, false};
+  int half_detents = 0;
+  int full_detents = 0;
+  for (int i = 0; i < 4; i++) {
+    half_detents += half.update(a[i], b[i]);
+    full_detents += full.update(a[i], b[i]);
+  }
+  TEST_ASSERT_EQUAL_INT(2, half_detents);
+  TEST_ASSERT_EQUAL_INT(1, full_detents);
+  TEST_ASSERT_EQUAL_INT32(2, half.get_position());
+  TEST_ASSERT_EQUAL_INT32(1, full.get_position());
+}
+
+void test_illegal_transition_counted_and_drops_progress() {
+  QuadratureDecoder decoder(4);
+  decoder.update(false, true);
+  decoder.update(true, true);
+  TEST_ASSERT_EQUAL_INT(2, decoder.get_progress());
+
+  // 11 -> 00: an edge went missing
+  TEST_ASSERT_EQUAL_INT(0, decoder.update(false, false));
+  TEST_ASSERT_EQUAL_UINT32(1, decoder.get_error_count());
+  TEST_ASSERT_EQUAL_INT(0, decoder.get_progress());
+  TEST_ASSERT_EQUAL_UINT8(0b00, decoder.get_state());
+  TEST_ASSERT_EQUAL_INT32(0, decoder.get_position());
+}
+
+void test_channel_updates_and_timestamps() {
+  QuadratureDecoder decoder(2);
+  TEST_ASSERT_EQUAL_INT(0, decoder.update_channel(false, true, 1000));
+  TEST_ASSERT_EQUAL_INT(0, decoder.update_channel(false, true, 1500));  // Same level: ignored
+  TEST_ASSERT_EQUAL_UINT32(1000, decoder.get_step_us());
+  TEST_ASSERT_EQUAL_INT(1, decoder.update_channel(true, true, 4000));
+  TEST_ASSERT_EQUAL_UINT32(3000, decoder.get_step_interval_us());
+
+  // Counter-clockwise back through the same states
+  TEST_ASSERT_EQUAL_INT(0, decoder.update_channel(true, false, 5000));
+  TEST_ASSERT_EQUAL_INT(-1, decoder.update_channel(false, false, 6000));
+  TEST_ASSERT_EQUAL_INT32(0, decoder.get_position());
+  TEST_ASSERT_EQUAL_UINT32(0, decoder.get_error_count());
+}
+
+void test_trace_matches_reference() {
+  std::vector<Edge> trace = browse_trace();
+  QuadratureDecoder decoder(2);
+  ReferenceDecoder reference;
+  int detents = 0;
+  for (const auto &edge : trace) {
+    int8_t expected = reference.update_channel(edge.is_a, edge.level);
+    TEST_ASSERT_EQUAL_INT(expected, decoder.update_channel(edge.is_a, edge.level, edge.timestamp_us));
+    detents += expected;
+  }
+  TEST_ASSERT_EQUAL_INT(46 - 14, detents);
+  TEST_ASSERT_EQUAL_INT32(detents, decoder.get_position());
+}
+
+void test_benchmark_trace_replay() {
+  std::vector<Edge> trace = browse_trace();
+  const int passes = 20000;
+  volatile int32_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++) {
+    ReferenceDecoder reference;
+    int32_t position = 0;
+    for (const auto &edge : trace) {
+      position += reference.update_channel(edge.is_a, edge.level);
+    }
+    sink = sink + position;
+  }
+  auto before = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int p = 0; p < passes; p++) {
+    QuadratureDecoder decoder(2);
+    for (const auto &edge : trace) {
+      decoder.update_channel(edge.is_a, edge.level, edge.timestamp_us);
+    }
+    sink = sink + decoder.get_position();
+  }
+  auto after = std::chrono::steady_clock::now() - start;
+
+  double edges = double(passes) * trace.size();
+  double before_ns = std::chrono::duration<double, std::nano>(before).count() / edges;
+  double after_ns = std::chrono::duration<double, std::nano>(after).count() / edges;
+  char message[128];
+  snprintf(message, sizeof(message), "%u-edge trace replay: %.1f ns/edge before, %.1f ns/edge after (%.1fx)",
+           (unsigned) trace.size(), before_ns, after_ns, before_ns / after_ns);
+  TEST_MESSAGE(message);
+  (void) sink;
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_table_follows_gray_code);
+  RUN_TEST(test_steps_per_detent);
+  RUN_TEST(test_illegal_transition_counted_and_drops_progress);
+  RUN_TEST(test_channel_updates_and_timestamps);
+  RUN_TEST(test_trace_matches_reference);
+  RUN_TEST(test_benchmark_trace_replay);
+
+  return UNITY_END();
+}
@@ -0,0 +1,524 @@
+/**
+ * @file test_retrotext_display.cpp
+ * @brief Unit tests for RetroTextDisplay text decoding, rendering, scrolling,
+ *        frame scheduling and shimmer timing
+ *
+ * The display runs against a bus that accepts every write; frame counts come
+ * from the per-board driver statistics.
+ */
+
+#include <unity.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "esphome/components/retrotext_display/retrotext_display.h"
+
+using namespace esphome;
+using namespace esphome::retrotext_display;
+
+namespace {
+
+class NullBus : public i2c::I2CBus {
+ public:
+  i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                              size_t read_count) override {
+    memset(read_buffer, 0, read_count);
+    return i2c::ERROR_OK;
+  }
+};
+
+// Takes bus time like a 400 kHz I2C bus: about 9 bit times (22.5 us) per byte
+class SlowBus : public NullBus {
+ public:
+  i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                              size_t read_count) override {
+    size_t bytes = 1 + write_count + read_count;  // Address byte
+    host_time::advance_us(bytes * 45 / 2);
+    return NullBus::write_readv(address, write_buffer, write_count, read_buffer, read_count);
+  }
+};
+
+class TestDisplay : public RetroTextDisplay {
+ public:
+  uint32_t frames() const { return this->drivers_[0]->get_stats().frames; }
+  uint8_t column(int x) const { return this->columns_[x]; }
+  uint8_t glyph(int i) const { return this->glyphs_[i]; }
+  uint8_t prefix() const { return this->stationary_prefix_chars_; }
+  uint8_t pixel(int x, int y) const {
+    return (this->columns_[x] & (1 << y)) ? this->column_brightness_[x] : 0;
+  }
+};
+
+NullBus *bus;
+TestDisplay *display;
+
+// Run loop() every millisecond for the given time
+void run_for_ms(uint32_t ms) {
+  for (uint32_t i = 0; i < ms; i++) {
+    host_time::advance_ms(1);
+    display->loop();
+  }
+}
+
+}  // namespace
+
+void setUp(void) {
+  host_time::reset();
+  bus = new NullBus();
+  display = new TestDisplay();
+  display->set_i2c_bus(bus);
+  display->set_board_addresses(0x50, 0x5A, 0x5F);
+  display->setup();  // Shows "CONNECTING..." with shimmer on
+}
+
+void tearDown(void) {
+  delete display;
+  delete bus;
+}
+
+// Brightest pixel in the columns of one character cell
+uint8_t cell_brightness(int cell) {
+  uint8_t max = 0;
+  for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+    for (int x = cell * 4; x < cell * 4 + 4; x++) {
+      if (display->pixel(x, y) > max) {
+        max = display->pixel(x, y);
+      }
+    }
+  }
+  return max;
+}
+
+// Settle the boot message and stop the shimmer so only the test's changes render
+void settle() {
+  display->set_shimmer_mode(false);
+  run_for_ms(50);
+  display->reset_frame_stats();
+}
+
+void test_mutations_coalesce_into_one_frame() {
+  settle();
+  uint32_t start = display->frames();
+
+  // Several updates in one logical action (e.g. preset activation)
+  display->set_text("PRESET 1");
+  display->set_text("LOADING");
+  display->set_text("\x80 RADIO ONE");
+  TEST_ASSERT_EQUAL(0, display->frames() - start);  // Nothing pushed yet
+
+  run_for_ms(1);
+  TEST_ASSERT_EQUAL(1, display->frames() - start);
+  TEST_ASSERT_EQUAL(1, display->get_frame_stats().frames_rendered);
+  TEST_ASSERT_EQUAL(2, display->get_frame_stats().frames_dropped);
+}
+
+void test_at_most_one_frame_per_tick() {
+  settle();
+  uint32_t start = display->frames();
+  char text[16];
+  for (int i = 0; i < 160; i++) {
+    snprintf(text, sizeof(text), "COUNT %d", i);
+    display->set_text(text);
+    run_for_ms(1);
+  }
+  // 160 ms of changes every millisecond at a 16 ms tick
+  TEST_ASSERT_UINT32_WITHIN(1, 160 / DISPLAY_FRAME_INTERVAL_MS, display->frames() - start);
+  TEST_ASSERT_EQUAL(display->frames() - start, display->get_frame_stats().frames_rendered);
+}
+
+void test_set_text_with_brightness_deferred() {
+  settle();
+  uint32_t start = display->frames();
+  display->set_text_with_brightness("01.02 12:34", 60, 180, 6);
+  TEST_ASSERT_EQUAL(0, display->frames() - start);
+
+  run_for_ms(1);
+  TEST_ASSERT_EQUAL(1, display->frames() - start);
+  TEST_ASSERT_EQUAL(60, cell_brightness(0));   // '0' of the date
+  TEST_ASSERT_EQUAL(180, cell_brightness(6));  // '1' of the time
+}
+
+void test_clear_is_deferred() {
+  settle();
+  display->set_text("HELLO");
+  run_for_ms(20);
+  TEST_ASSERT_NOT_EQUAL(0, cell_brightness(0));
+
+  uint32_t start = display->frames();
+  display->clear();
+  TEST_ASSERT_EQUAL(0, display->frames() - start);
+  run_for_ms(20);
+  TEST_ASSERT_EQUAL(1, display->frames() - start);
+  TEST_ASSERT_EQUAL(0, cell_brightness(0));
+}
+
+void test_push_time_recorded() {
+  settle();
+  display->set_text("TIMING");
+  run_for_ms(20);
+  const DisplayFrameStats &stats = display->get_frame_stats();
+  TEST_ASSERT_EQUAL(1, stats.frames_rendered);
+  TEST_ASSERT_GREATER_OR_EQUAL(stats.push_time_last_us, stats.push_time_max_us);
+  TEST_ASSERT_EQUAL(stats.push_time_last_us, stats.average_push_us());
+}
+
+const char *const LONG_TEXT = "THIS IS A LONG STATION NAME";  // 27 characters
+
+// Column x of ASCII text (plus " * " separator) as rendered into the scroll strip
+uint8_t text_column(const char *text, int x) {
+  std::string strip = std::string(text) + " * ";
+  x %= strip.size() * GLYPH_WIDTH;
+  return glyph_columns(strip[x / GLYPH_WIDTH])[x % GLYPH_WIDTH];
+}
+
+void assert_window(const char *text, int offset, int first_x) {
+  for (int x = first_x; x < DISPLAY_WIDTH; x++) {
+    TEST_ASSERT_EQUAL_HEX8(text_column(text, offset + x - first_x), display->column(x));
+  }
+}
+
+void test_long_text_waits_before_scrolling() {
+  settle();
+  display->set_text(LONG_TEXT);
+  run_for_ms(900);
+  assert_window(LONG_TEXT, 0, 0);
+}
+
+void test_step_scroll_moves_whole_characters() {
+  settle();
+  display->set_text(LONG_TEXT);
+  run_for_ms(1000 + 20);  // First step right after the start delay, then one frame tick
+  assert_window(LONG_TEXT, GLYPH_WIDTH, 0);
+  run_for_ms(300);
+  assert_window(LONG_TEXT, 2 * GLYPH_WIDTH, 0);
+}
+
+void test_smooth_scroll_moves_one_pixel() {
+  settle();
+  display->set_smooth_scroll(true);
+  display->set_text(LONG_TEXT);
+  run_for_ms(1000 + 20);
+  assert_window(LONG_TEXT, 1, 0);
+  run_for_ms(75);
+  assert_window(LONG_TEXT, 2, 0);
+}
+
+void test_smooth_scroll_wraps_after_separator() {
+  settle();
+  display->set_smooth_scroll(true);
+  display->set_text(LONG_TEXT);
+  int cycle = (strlen(LONG_TEXT) + 3) * GLYPH_WIDTH;
+  run_for_ms(1000 + 20);
+  for (int step = 1; step <= cycle + 5; step++) {
+    assert_window(LONG_TEXT, step, 0);
+    run_for_ms(75);
+  }
+}
+
+void test_smooth_scroll_keeps_icon_prefix() {
+  settle();
+  display->set_smooth_scroll(true);
+  std::string text = std::string("\x80 ") + LONG_TEXT;
+  display->set_text(text.c_str());
+  run_for_ms(1000 + 20 + 9 * 75);
+  for (int col = 0; col < GLYPH_WIDTH; col++) {
+    TEST_ASSERT_EQUAL_HEX8(glyph_columns(128)[col], display->column(col));
+    TEST_ASSERT_EQUAL_HEX8(0, display->column(GLYPH_WIDTH + col));  // Space after the icon
+  }
+  assert_window(LONG_TEXT, 10, 2 * GLYPH_WIDTH);
+}
+
+void test_short_text_does_not_scroll() {
+  settle();
+  display->set_smooth_scroll(true);
+  display->set_text("SHORT");
+  run_for_ms(20);
+  uint32_t start = display->frames();
+  run_for_ms(3000);
+  TEST_ASSERT_EQUAL(0, display->frames() - start);
+  for (int x = 0; x < DISPLAY_WIDTH; x++) {
+    uint8_t expected = x < 5 * GLYPH_WIDTH ? text_column("SHORT", x) : 0;
+    TEST_ASSERT_EQUAL_HEX8(expected, display->column(x));
+  }
+}
+
+// Expected strip column for a glyph sequence (plus " * " separator)
+uint8_t glyph_strip_column(const std::vector<uint8_t> &glyphs, int x) {
+  std::vector<uint8_t> strip = glyphs;
+  strip.insert(strip.end(), {' ', '*', ' '});
+  x %= strip.size() * GLYPH_WIDTH;
+  return glyph_columns(strip[x / GLYPH_WIDTH])[x % GLYPH_WIDTH];
+}
+
+void test_multibyte_decoded_to_glyphs() {
+  display->set_text("Caf\xC3\xA9 M\xC3\xBCller");  // "Café Müller", 13 bytes
+  TEST_ASSERT_EQUAL(11, display->get_glyph_count());
+  TEST_ASSERT_EQUAL('f', display->glyph(2));
+  TEST_ASSERT_EQUAL(141, display->glyph(3));  // é → e with dot
+  TEST_ASSERT_EQUAL(' ', display->glyph(4));
+  TEST_ASSERT_EQUAL(144, display->glyph(6));  // ü → u with dot
+  TEST_ASSERT_EQUAL('l', display->glyph(7));
+}
+
+void test_multibyte_static_render() {
+  settle();
+  display->set_text("\xC3\x81GUA \xC3\xB1");  // "ÁGUA ñ"
+  run_for_ms(20);
+  std::vector<uint8_t> glyphs = {'A', 'G', 'U', 'A', ' ', 145};
+  for (int x = 0; x < DISPLAY_WIDTH; x++) {
+    uint8_t expected = x < 6 * GLYPH_WIDTH ? glyph_strip_column(glyphs, x) : 0;
+    TEST_ASSERT_EQUAL_HEX8(expected, display->column(x));
+  }
+}
+
+void test_multibyte_fits_without_scrolling() {
+  // 18 glyphs but 36 bytes: must not scroll in auto mode
+  settle();
+  display->set_text("\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9"
+                    "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9");
+  TEST_ASSERT_EQUAL(18, display->get_glyph_count());
+  run_for_ms(20);
+  uint32_t start = display->frames();
+  run_for_ms(3000);
+  TEST_ASSERT_EQUAL(0, display->frames() - start);
+}
+
+void test_multibyte_scroll_wraps_on_glyph_count() {
+  settle();
+  display->set_smooth_scroll(true);
+  // 20 glyphs: "Beyoncé – Déjà Vu ♪" mixes 2- and 3-byte sequences
+  display->set_text("Beyonc\xC3\xA9 \xE2\x80\x93 D\xC3\xA9j\xC3\xA0 Vu \xE2\x99\xAA!");
+  TEST_ASSERT_EQUAL(20, display->get_glyph_count());
+  std::vector<uint8_t> glyphs;
+  for (int i = 0; i < display->get_glyph_count(); i++) {
+    glyphs.push_back(display->glyph(i));
+  }
+  TEST_ASSERT_EQUAL(136, glyphs[18]);  // ♪
+
+  int cycle = (20 + 3) * GLYPH_WIDTH;
+  run_for_ms(1000 + 20);
+  for (int step = 1; step <= cycle + 2; step++) {
+    for (int x = 0; x < DISPLAY_WIDTH; x++) {
+      TEST_ASSERT_EQUAL_HEX8(glyph_strip_column(glyphs, step + x), display->column(x));
+    }
+    run_for_ms(75);
+  }
+}
+
+void test_utf8_icon_prefix_stays() {
+  // "▶ " as UTF-8 is detected like the single-byte icon
+  display->set_text("\xE2\x96\xB6 STATION");
+  TEST_ASSERT_EQUAL(128, display->glyph(0));
+  TEST_ASSERT_EQUAL(2, display->prefix());
+}
+
+void test_four_byte_sequence_is_one_glyph() {
+  display->set_text("A\xF0\x9F\x8E\xB5" "B");  // "A🎵B"
+  TEST_ASSERT_EQUAL(3, display->get_glyph_count());
+  TEST_ASSERT_EQUAL('A', display->glyph(0));
+  TEST_ASSERT_EQUAL(' ', display->glyph(1));
+  TEST_ASSERT_EQUAL('B', display->glyph(2));
+}
+
+void test_truncated_multibyte_at_end() {
+  display->set_text("AB\xC3");  // Lead byte without continuation
+  TEST_ASSERT_EQUAL(3, display->get_glyph_count());
+  display->set_text("AB\xE2\x96");
+  TEST_ASSERT_LESS_OR_EQUAL(4, display->get_glyph_count());
+}
+
+// Display on a bus that takes real (simulated) time, with the given push budget
+TestDisplay *make_timed_display(SlowBus *slow_bus, uint32_t budget_us) {
+  TestDisplay *timed = new TestDisplay();
+  timed->set_i2c_bus(slow_bus);
+  timed->set_board_addresses(0x50, 0x5A, 0x5F);
+  timed->set_push_budget(budget_us);
+  timed->setup();
+  timed->set_shimmer_mode(false);
+  return timed;
+}
+
+void test_push_sliced_under_budget() {
+  SlowBus slow_bus;
+  TestDisplay *timed = make_timed_display(&slow_bus, 2000);
+
+  // First frame is a full push: 3 boards × 3 chunks of ~1.5 ms
+  int loops = 0;
+  uint32_t fence = timed->get_frame_fence();
+  while (!timed->is_frame_complete(fence) && loops < 100) {
+    host_time::advance_ms(1);
+    timed->loop();
+    loops++;
+  }
+  TEST_ASSERT_TRUE(timed->is_frame_complete(fence));
+  TEST_ASSERT_GREATER_THAN(3, loops);
+
+  // A slice stops once the budget is used, so it overruns by at most one burst write
+  const DisplayFrameStats &stats = timed->get_frame_stats();
+  TEST_ASSERT_LESS_THAN(2000 + 1600, stats.longest_blocking_us);
+  TEST_ASSERT_GREATER_THAN(stats.longest_blocking_us, stats.push_time_last_us);
+  delete timed;
+}
+
+void test_push_blocking_without_budget() {
+  SlowBus slow_bus;
+  TestDisplay *timed = make_timed_display(&slow_bus, 0);
+  uint32_t fence = timed->get_frame_fence();
+  host_time::advance_ms(1);
+  timed->loop();
+  TEST_ASSERT_TRUE(timed->is_frame_complete(fence));
+  const DisplayFrameStats &stats = timed->get_frame_stats();
+  TEST_ASSERT_EQUAL(stats.push_time_last_us, stats.longest_blocking_us);
+  delete timed;
+}
+
+void test_fence_tracks_pending_changes() {
+  SlowBus slow_bus;
+  TestDisplay *timed = make_timed_display(&slow_bus, 2000);
+  for (int i = 0; i < 100; i++) {
+    host_time::advance_ms(1);
+    timed->loop();
+  }
+  uint32_t idle_fence = timed->get_frame_fence();
+  TEST_ASSERT_TRUE(timed->is_frame_complete(idle_fence));
+
+  timed->set_text("NEW STATION NAME");
+  uint32_t fence = timed->get_frame_fence();
+  TEST_ASSERT_EQUAL(idle_fence + 1, fence);
+  TEST_ASSERT_FALSE(timed->is_frame_complete(fence));
+
+  // A change made while that frame is in flight needs the frame after it
+  host_time::advance_ms(1);
+  timed->loop();
+  timed->set_text("OTHER STATION");
+  uint32_t next_fence = timed->get_frame_fence();
+  TEST_ASSERT_EQUAL(fence + 1, next_fence);
+
+  for (int i = 0; i < 200 && !timed->is_frame_complete(next_fence); i++) {
+    host_time::advance_ms(1);
+    timed->loop();
+  }
+  TEST_ASSERT_TRUE(timed->is_frame_complete(fence));
+  TEST_ASSERT_TRUE(timed->is_frame_complete(next_fence));
+  delete timed;
+}
+
+void test_no_render_while_push_in_flight() {
+  SlowBus slow_bus;
+  TestDisplay *timed = make_timed_display(&slow_bus, 1);  // One burst write per loop
+  host_time::advance_ms(1);
+  timed->loop();  // Renders the boot frame and starts the full push
+  uint32_t rendered = timed->get_frame_stats().frames_rendered;
+
+  timed->set_text("CHANGED");
+  for (int i = 0; i < 5; i++) {
+    host_time::advance_ms(20);
+    timed->loop();
+  }
+  TEST_ASSERT_EQUAL(rendered, timed->get_frame_stats().frames_rendered);
+  delete timed;
+}
+
+void test_shimmer_sine_table_matches_sinf() {
+  for (int i = 0; i < 256; i++) {
+    float expected = 127.0f * sinf(i * 2.0f * 3.14159265f / 256.0f);
+    TEST_ASSERT_INT_WITHIN(1, (int) lroundf(expected), SHIMMER_SINE[i]);
+  }
+}
+
+void test_shimmer_pixel_matches_float_wave() {
+  for (int phase = 0; phase < 256; phase += 17) {
+    for (int y = 0; y < 6; y++) {
+      for (int x = 0; x < 72; x++) {
+        float angle = x / 72.0f * 12.56637061f + y * 0.52359878f - phase * 6.28318531f / 256.0f;
+        float expected = 200.0f * (1.0f + 0.4f * sinf(angle));
+        if (expected > 255.0f) {
+          expected = 255.0f;
+        }
+        // Angles are quantized to 1/256 cycle, so allow a few steps of error
+        TEST_ASSERT_INT_WITHIN(6, (int) expected, shimmer_pixel(200, x, y, phase));
+      }
+    }
+  }
+}
+
+void test_shimmer_pixel_clamps() {
+  // Peak of the wave at full brightness must saturate, not wrap around
+  uint8_t max_seen = 0;
+  for (int phase = 0; phase < 256; phase++) {
+    uint8_t value = shimmer_pixel(255, 0, 0, phase);
+    TEST_ASSERT_GREATER_OR_EQUAL(150, value);
+    if (value > max_seen) {
+      max_seen = value;
+    }
+  }
+  TEST_ASSERT_EQUAL(255, max_seen);
+}
+
+void test_shimmer_phase_from_elapsed_time() {
+  TEST_ASSERT_EQUAL(0, shimmer_phase_at(0));
+  TEST_ASSERT_EQUAL(128, shimmer_phase_at(SHIMMER_CYCLE_MS / 2));
+  TEST_ASSERT_EQUAL(0, shimmer_phase_at(SHIMMER_CYCLE_MS));
+  TEST_ASSERT_EQUAL(shimmer_phase_at(100), shimmer_phase_at(100 + 7 * SHIMMER_CYCLE_MS));
+}
+
+void test_shimmer_capped_to_frame_rate() {
+  uint32_t start = display->frames();
+  run_for_ms(1000);
+  // 30 fps default, plus the initial text render
+  uint32_t frames = display->frames() - start;
+  TEST_ASSERT_UINT32_WITHIN(2, 31, frames);
+}
+
+void test_shimmer_fps_configurable() {
+  display->set_shimmer_fps(10);
+  display->set_shimmer_mode(true);
+  run_for_ms(50);  // Initial text render and first shimmer frame
+  uint32_t start = display->frames();
+  run_for_ms(1000);
+  TEST_ASSERT_UINT32_WITHIN(1, 10, display->frames() - start);
+}
+
+void test_no_frames_without_shimmer() {
+  display->set_shimmer_mode(false);
+  run_for_ms(50);
+  uint32_t start = display->frames();
+  run_for_ms(1000);
+  TEST_ASSERT_EQUAL(0, display->frames() - start);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_multibyte_decoded_to_glyphs);
+  RUN_TEST(test_multibyte_static_render);
+  RUN_TEST(test_multibyte_fits_without_scrolling);
+  RUN_TEST(test_multibyte_scroll_wraps_on_glyph_count);
+  RUN_TEST(test_utf8_icon_prefix_stays);
+  RUN_TEST(test_four_byte_sequence_is_one_glyph);
+  RUN_TEST(test_truncated_multibyte_at_end);
+  RUN_TEST(test_mutations_coalesce_into_one_frame);
+  RUN_TEST(test_at_most_one_frame_per_tick);
+  RUN_TEST(test_set_text_with_brightness_deferred);
+  RUN_TEST(test_clear_is_deferred);
+  RUN_TEST(test_push_time_recorded);
+  RUN_TEST(test_long_text_waits_before_scrolling);
+  RUN_TEST(test_step_scroll_moves_whole_characters);
+  RUN_TEST(test_smooth_scroll_moves_one_pixel);
+  RUN_TEST(test_smooth_scroll_wraps_after_separator);
+  RUN_TEST(test_smooth_scroll_keeps_icon_prefix);
+  RUN_TEST(test_short_text_does_not_scroll);
+  RUN_TEST(test_push_sliced_under_budget);
+  RUN_TEST(test_push_blocking_without_budget);
+  RUN_TEST(test_fence_tracks_pending_changes);
+  RUN_TEST(test_no_render_while_push_in_flight);
+  RUN_TEST(test_shimmer_sine_table_matches_sinf);
+  RUN_TEST(test_shimmer_pixel_matches_float_wave);
+  RUN_TEST(test_shimmer_pixel_clamps);
+  RUN_TEST(test_shimmer_phase_from_elapsed_time);
+  RUN_TEST(test_shimmer_capped_to_frame_rate);
+  RUN_TEST(test_shimmer_fps_configurable);
+  RUN_TEST(test_no_frames_without_shimmer);
+  return UNITY_END();
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test_retrotext_layout.cpp
+ * @brief Tests and host benchmark for the precomputed pixel → register table
+ *
+ * The reference mapping below is the per-pixel arithmetic RetroTextDisplay
+ * used before retrotext_layout.h: flip, board split, 24×6 → 12×12 fold into
+ * a 144-byte driver buffer, then CS7-12 remap into the register image.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "esphome/components/retrotext_display/retrotext_display.h"
+
+using namespace esphome;
+using namespace esphome::retrotext_display;
+
+namespace {
+
+class NullBus : public i2c::I2CBus {
+ public:
+  i2c::ErrorCode write_readv(uint8_t address, const uint8_t *write_buffer, size_t write_count, uint8_t *read_buffer,
+                              size_t read_count) override {
+    memset(read_buffer, 0, read_count);
+    return i2c::ERROR_OK;
+  }
+};
+
+// Exposes the framebuffer and register images without going through I2C
+class TestDisplay : public RetroTextDisplay {
+ public:
+  bool begin(i2c::I2CBus *bus) {
+    this->set_i2c_bus(bus);
+    this->set_board_addresses(0x50, 0x5A, 0x5F);
+    return this->initialize_boards_();
+  }
+  // Random glyph columns and per-column brightness; returns the row-major pixel values
+  void random_frame(std::mt19937 &rng, uint8_t *pixels) {
+    for (int x = 0; x < DISPLAY_WIDTH; x++) {
+      this->columns_[x] = rng() & 0x3F;
+      this->column_brightness_[x] = rng() & 0xFF;
+      for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        pixels[y * DISPLAY_WIDTH + x] = (this->columns_[x] & (1 << y)) ? this->column_brightness_[x] : 0;
+      }
+    }
+  }
+  void render() { this->update_display_(); }
+  const uint8_t *image(int board) { return this->drivers_[board]->register_image(); }
+};
+
+// Previous implementation: per-pixel coordinate math into 144-byte driver buffers
+void reference_render(const uint8_t *framebuffer, uint8_t images[DISPLAY_BOARDS][IS31FL3737_PWM_REGISTER_SIZE]) {
+  uint8_t pwm_buffer[DISPLAY_BOARDS][IS31FL3737_PWM_BUFFER_SIZE];
+  memset(pwm_buffer, 0, sizeof(pwm_buffer));
+
+  for (int y = 0; y < 6; y++) {
+    for (int x = 0; x < 72; x++) {
+      int screen_x = 72 - x - 1;
+      int screen_y = 6 - y - 1;
+      int board = screen_x / 24;
+      int local_x = screen_x % 24;
+      int char_index = local_x / 4;
+      int char_pixel_x = local_x % 4;
+      int physical_x, physical_y;
+      if (char_index < 3) {
+        physical_x = (char_index * 4) + char_pixel_x;
+        physical_y = screen_y;
+      } else {
+        physical_x = ((char_index - 3) * 4) + char_pixel_x;
+        physical_y = screen_y + 6;
+      }
+      pwm_buffer[board][physical_y * IS31FL3737_MATRIX_WIDTH + physical_x] = framebuffer[y * 72 + x];
+    }
+  }
+
+  for (int board = 0; board < DISPLAY_BOARDS; board++) {
+    memset(images[board], 0, IS31FL3737_PWM_REGISTER_SIZE);
+    for (uint8_t y = 0; y < IS31FL3737_MATRIX_HEIGHT; y++) {
+      for (uint8_t x = 0; x < IS31FL3737_MATRIX_WIDTH; x++) {
+        uint8_t cs = x + 1;
+        if (cs >= 7) {
+          cs += 2;
+        }
+        images[board][y * IS31FL3737_REGISTER_STRIDE + (cs - 1)] = pwm_buffer[board][y * IS31FL3737_MATRIX_WIDTH + x];
+      }
+    }
+  }
+}
+
+void random_frame(std::mt19937 &rng, uint8_t *framebuffer) {
+  for (size_t i = 0; i < DISPLAY_PIXELS; i++) {
+    framebuffer[i] = rng() & 0xFF;
+  }
+}
+
+}  // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_table_uses_each_register_once() {
+  std::vector<int> uses(DISPLAY_BOARDS * IS31FL3737_PWM_REGISTER_SIZE, 0);
+  for (const PixelRegister &p : PIXEL_MAP.pixels) {
+    TEST_ASSERT_LESS_THAN(DISPLAY_BOARDS, p.board);
+    TEST_ASSERT_LESS_THAN(IS31FL3737_PWM_REGISTER_SIZE, p.reg);
+    uses[p.board * IS31FL3737_PWM_REGISTER_SIZE + p.reg]++;
+  }
+  int used = 0;
+  for (int count : uses) {
+    TEST_ASSERT_LESS_OR_EQUAL(1, count);
+    used += count;
+  }
+  TEST_ASSERT_EQUAL(DISPLAY_PIXELS, used);
+}
+
+void test_table_corners() {
+  // Display is mounted upside down: logical top-left is the last board's bottom-right LED
+  PixelRegister top_left = PIXEL_MAP.pixels[0];
+  TEST_ASSERT_EQUAL(2, top_left.board);
+  TEST_ASSERT_EQUAL(11 * 16 + 13, top_left.reg);  // SW12, CS12 (remapped to register column 13)
+
+  PixelRegister bottom_right = PIXEL_MAP.pixels[DISPLAY_PIXELS - 1];
+  TEST_ASSERT_EQUAL(0, bottom_right.board);
+  TEST_ASSERT_EQUAL(0x00, bottom_right.reg);  // SW1, CS1
+}
+
+void test_matches_reference_mapping() {
+  NullBus bus;
+  TestDisplay display;
+  TEST_ASSERT_TRUE(display.begin(&bus));
+
+  std::mt19937 rng(1234);
+  uint8_t pixels[DISPLAY_PIXELS];
+  uint8_t expected[DISPLAY_BOARDS][IS31FL3737_PWM_REGISTER_SIZE];
+  for (int frame = 0; frame < 20; frame++) {
+    display.random_frame(rng, pixels);
+    display.render();
+    reference_render(pixels, expected);
+    for (int board = 0; board < DISPLAY_BOARDS; board++) {
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(expected[board], display.image(board), IS31FL3737_PWM_REGISTER_SIZE);
+    }
+  }
+}
+
+void test_benchmark_mapping() {
+  const int frames = 20000;
+  std::mt19937 rng(42);
+  uint8_t framebuffer[DISPLAY_PIXELS];
+  random_frame(rng, framebuffer);
+  uint8_t images[DISPLAY_BOARDS][IS31FL3737_PWM_REGISTER_SIZE] = {};
+  volatile uint8_t sink = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; i++) {
+    framebuffer[i % DISPLAY_PIXELS] = i;
+    reference_render(framebuffer, images);
+    sink = sink + images[i % DISPLAY_BOARDS][i % IS31FL3737_PWM_REGISTER_SIZE];
+  }
+  auto before = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; i++) {
+    framebuffer[i % DISPLAY_PIXELS] = i;
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      for (uint8_t y = 0; y < DISPLAY_HEIGHT; y++) {
+        const PixelRegister &p = PIXEL_MAP.pixels[x * DISPLAY_HEIGHT + y];
+        images[p.board][p.reg] = framebuffer[y * DISPLAY_WIDTH + x];
+      }
+    }
+    sink = sink + images[i % DISPLAY_BOARDS][i % IS31FL3737_PWM_REGISTER_SIZE];
+  }
+  auto after = std::chrono::steady_clock::now() - start;
+
+  double before_ns = std::chrono::duration<double, std::nano>(before).count() / frames;
+  double after_ns = std::chrono::duration<double, std::nano>(after).count() / frames;
+  char message[128];
+  snprintf(message, sizeof(message), "framebuffer -> register images: %.0f ns/frame before, %.0f ns/frame after (%.1fx)",
+           before_ns, after_ns, before_ns / after_ns);
+  TEST_MESSAGE(message);
+  (void) sink;
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_uses_each_register_once);
+  RUN_TEST(test_table_corners);
+  RUN_TEST(test_matches_reference_mapping);
+  RUN_TEST(test_benchmark_mapping);
+  return UNITY_END();
+}
@@ -0,0 +1,96 @@
+/**
+ * @file test_string_arena.cpp
+ * @brief Tests for the browse list string arena
+ */
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "esphome/components/radio_controller/string_arena.h"
+
+using namespace esphome::radio_controller;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_strings_are_terminated_and_compare() {
+  StringArena arena;
+  ArenaString radio = arena.add("Radio Paradise");
+  ArenaString uri = arena.add(std::string("library://radio/12"));
+  ArenaString cut = arena.add("Jazz24 extra", 6);
+
+  TEST_ASSERT_EQUAL_STRING("Radio Paradise", arena.c_str(radio));
+  TEST_ASSERT_EQUAL_STRING("library://radio/12", arena.c_str(uri));
+  TEST_ASSERT_EQUAL_STRING("Jazz24", arena.c_str(cut));
+  TEST_ASSERT_TRUE(arena.equals(cut, "Jazz24", 6));
+  TEST_ASSERT_FALSE(arena.equals(cut, "Jazz2", 5));
+  TEST_ASSERT_TRUE(arena.str(uri) == "library://radio/12");
+  // Text plus NUL, back to back
+  TEST_ASSERT_EQUAL_UINT32(15 + 19 + 7, arena.get_size());
+  TEST_ASSERT_EQUAL_UINT32(15, uri.offset);
+}
+
+void test_empty_strings_take_no_space() {
+  StringArena arena;
+  ArenaString empty = arena.add("");
+  TEST_ASSERT_TRUE(empty.empty());
+  TEST_ASSERT_EQUAL_STRING("", arena.c_str(empty));
+  TEST_ASSERT_EQUAL_STRING("", arena.c_str(ArenaString{}));
+  arena.release(empty);
+  TEST_ASSERT_EQUAL_UINT32(0, arena.get_size());
+  TEST_ASSERT_EQUAL_UINT32(0, arena.get_garbage());
+}
+
+void test_release_counts_garbage_until_compacted() {
+  StringArena arena;
+  std::vector<ArenaString> kept;
+  std::vector<ArenaString> dropped;
+  for (int i = 0; i < 50; i++) {
+    std::string name = "Station " + std::to_string(i);
+    (i % 3 == 0 ? kept : dropped).push_back(arena.add(name));
+  }
+  size_t size = arena.get_size();
+  for (const auto &string : dropped) {
+    arena.release(string);
+  }
+  TEST_ASSERT_EQUAL_UINT32(size, arena.get_size());
+  TEST_ASSERT_TRUE(arena.get_garbage() > arena.get_live());
+
+  size_t live = arena.get_live();
+  arena.compact([&kept](auto &&visit) {
+    for (auto &string : kept) {
+      visit(string);
+    }
+  });
+  TEST_ASSERT_EQUAL_UINT32(live, arena.get_size());
+  TEST_ASSERT_EQUAL_UINT32(0, arena.get_garbage());
+  for (size_t i = 0; i < kept.size(); i++) {
+    std::string name = "Station " + std::to_string(i * 3);
+    TEST_ASSERT_EQUAL_STRING(name.c_str(), arena.c_str(kept[i]));
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, kept[0].offset);
+}
+
+void test_strings_added_after_compaction_follow_the_live_ones() {
+  StringArena arena;
+  ArenaString old_name = arena.add("Old Favorite");
+  ArenaString name = arena.add("BBC Radio 6 Music");
+  arena.release(old_name);
+  arena.compact([&name](auto &&visit) { visit(name); });
+
+  ArenaString next = arena.add("KEXP");
+  TEST_ASSERT_EQUAL_STRING("BBC Radio 6 Music", arena.c_str(name));
+  TEST_ASSERT_EQUAL_STRING("KEXP", arena.c_str(next));
+  TEST_ASSERT_EQUAL_UINT32(18, next.offset);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_strings_are_terminated_and_compare);
+  RUN_TEST(test_empty_strings_take_no_space);
+  RUN_TEST(test_release_counts_garbage_until_compacted);
+  RUN_TEST(test_strings_added_after_compaction_follow_the_live_ones);
+
+  return UNITY_END();
+}
@@ -10,6 +10,9 @@
   using platform::millis;
 #endif
 
+// Shared with the ESPHome radio_controller component
+#include "../../../esphome/components/radio_controller/quadrature_decoder.h"
+
 namespace Input {
 
 // Button control - tracks press/release state and timing
@@ -96,100 +99,52 @@ private:
 class EncoderControl {
 public:
   EncoderControl()
-    : position_(0)
-    , previous_position_(0)
-    , last_a_(0)
-    , last_b_(0)
-    , detent_state_(0)
+    : previous_position_(0)
+    , decoder_(STEPS_PER_DETENT)
     , button_() {}
   
   // Called when encoder channel goes HIGH (press event only)
   // Gray code sequence: 00 -> 01 -> 11 -> 10 -> 00 (clockwise)
   // Only counts complete detents (full 4-step cycles)
   void onChannelPress(bool is_a, unsigned long now) {
-    updateChannel(is_a, true, now);
+    decoder_.update_channel(is_a, true, toDecoderTime(now));
   }
   
   // Called when encoder channel goes LOW (release event)
   void onChannelRelease(bool is_a, unsigned long now) {
-    updateChannel(is_a, false, now);
+    decoder_.update_channel(is_a, false, toDecoderTime(now));
   }
   
   // Frame update
   void update(unsigned long now) {
-    previous_position_ = position_;
+    previous_position_ = position();
     button_.update(now);
   }
   
   // Query API
-  int position() const { return position_; }
-  int delta() const { return position_ - previous_position_; }
+  int position() const { return decoder_.get_position(); }
+  int delta() const { return position() - previous_position_; }
   bool changed() const { return delta() != 0; }
   
   ButtonControl& button() { return button_; }
   const ButtonControl& button() const { return button_; }
   
   // For debugging
-  uint8_t state() const { return (last_a_ << 1) | last_b_; }
-  int detentProgress() const { return detent_state_; }
+  uint8_t state() const { return decoder_.get_state(); }
+  int detentProgress() const { return decoder_.get_progress(); }
+  unsigned long errorCount() const { return decoder_.get_error_count(); }
+  // Time between the last two valid Gray code steps
+  unsigned long stepIntervalMs() const { return decoder_.get_step_interval_us() / 1000; }
   
 private:
-  int position_;
+  static constexpr uint8_t STEPS_PER_DETENT = 4;
+  
+  // The decoder counts microseconds; differences still hold across the wrap
+  static uint32_t toDecoderTime(unsigned long now_ms) { return static_cast<uint32_t>(now_ms * 1000UL); }
+  
   int previous_position_;
-  uint8_t last_a_;
-  uint8_t last_b_;
-  int8_t detent_state_;  // Tracks progress through 4-step detent cycle
+  esphome::radio_controller::QuadratureDecoder decoder_;  // Tracks progress through 4-step detent cycle
   ButtonControl button_;
-  
-  void updateChannel(bool is_a, bool new_value, unsigned long now) {
-    uint8_t current_a = last_a_;
-    uint8_t current_b = last_b_;
-    
-    // Update the channel
-    if (is_a) {
-      current_a = new_value ? 1 : 0;
-    } else {
-      current_b = new_value ? 1 : 0;
-    }
-    
-    // Calculate state (2-bit Gray code)
-    uint8_t old_state = (last_a_ << 1) | last_b_;
-    uint8_t new_state = (current_a << 1) | current_b;
-    
-    // Detect valid transitions and track detent progress
-    if (old_state != new_state) {
-      // Clockwise transitions
-      if ((old_state == 0b00 && new_state == 0b01) ||
-          (old_state == 0b01 && new_state == 0b11) ||
-          (old_state == 0b11 && new_state == 0b10) ||
-          (old_state == 0b10 && new_state == 0b00)) {
-        detent_state_++;
-        if (detent_state_ >= 4) {
-          position_++;
-          detent_state_ = 0;
-        }
-      }
-      // Counter-clockwise transitions  
-      else if ((old_state == 0b00 && new_state == 0b10) ||
-               (old_state == 0b10 && new_state == 0b11) ||
-               (old_state == 0b11 && new_state == 0b01) ||
-               (old_state == 0b01 && new_state == 0b00)) {
-        detent_state_--;
-        if (detent_state_ <= -4) {
-          position_--;
-          detent_state_ = 0;
-        }
-      }
-      else {
-        // Invalid transition - reset detent tracking
-        detent_state_ = 0;
-      }
-      
-      // Update state
-      last_a_ = current_a;
-      last_b_ = current_b;
-    }
-  }
 };
 
 // Multi-position switch control
@@ -120,6 +120,7 @@ void test_encoder_forward_turn() {
   TEST_ASSERT_EQUAL(1, enc.position());
   TEST_ASSERT_EQUAL(1, enc.delta());
   TEST_ASSERT_TRUE(enc.changed());
+  TEST_ASSERT_EQUAL(10, enc.stepIntervalMs());
 }
 
 void test_encoder_backward_turn() {
@@ -166,6 +167,22 @@ void test_encoder_multiple_turns() {
   TEST_ASSERT_EQUAL(3, enc.position());
 }
 
+void test_encoder_reversal_mid_detent() {
+  EncoderControl enc;
+  
+  enc.onChannelPress(false, 100);   // 00 -> 01
+  enc.onChannelPress(true, 110);    // 01 -> 11
+  enc.onChannelPress(true, 115);    // Repeated level: no step
+  TEST_ASSERT_EQUAL(2, enc.detentProgress());
+  
+  // Turn back before the detent completes
+  enc.onChannelRelease(true, 120);  // 11 -> 01
+  enc.onChannelRelease(false, 130); // 01 -> 00
+  TEST_ASSERT_EQUAL(0, enc.detentProgress());
+  TEST_ASSERT_EQUAL(0, enc.position());
+  TEST_ASSERT_EQUAL(0, enc.errorCount());
+}
+
 void test_encoder_button() {
   EncoderControl enc;
   
@@ -332,6 +349,7 @@ int main(int argc, char **argv) {
   RUN_TEST(test_encoder_backward_turn);
   RUN_TEST(test_encoder_delta_resets);
   RUN_TEST(test_encoder_multiple_turns);
+  RUN_TEST(test_encoder_reversal_mid_detent);
   RUN_TEST(test_encoder_button);
   
   // SwitchControl tests